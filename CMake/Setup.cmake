@@ -38,5 +38,23 @@ list(GET NUOODBC_VERSION 2 NUOODBC_VERSION_PATCH)
 
 set(NUOODBC_BUILD_KEY "${NUOODBC_VERSION_MAJOR}${NUOODBC_VERSION_MINOR}${NUOODBC_VERSION_PATCH}")
 
+# Floating point std::to_chars came with GCC 11: without it REAL and DOUBLE
+# values read as text are written with snprintf (see src/TextFormat.h).
+include(CheckCXXSourceCompiles)
+set(CMAKE_REQUIRED_FLAGS "${CMAKE_CXX17_STANDARD_COMPILE_OPTION}")
+check_cxx_source_compiles("
+#include <charconv>
+int main()
+{
+    char   out[32];
+    double value = 0.5;
+    return (int)(std::to_chars(out, out + sizeof(out), value).ptr - out);
+}" NUOODBC_HAVE_FLOAT_TO_CHARS)
+unset(CMAKE_REQUIRED_FLAGS)
+
+if(NUOODBC_HAVE_FLOAT_TO_CHARS)
+    add_compile_definitions(NUOODBC_FLOAT_TO_CHARS)
+endif()
+
 configure_file(etc/version.txt.in etc/version.txt)
 configure_file(src/ProductVersion.h.in src/ProductVersion.h)
@@ -0,0 +1,40 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <algorithm>
+
+#include "AdaptiveFetchSize.h"
+
+int AdaptiveFetchSize::getSize(size_t rowsetSize) const
+{
+    return (int)std::max<size_t>(size, std::min<size_t>(rowsetSize, ADAPTIVE_FETCH_MAX_ROWS));
+}
+
+void AdaptiveFetchSize::record(size_t rows, uint64_t micros)
+{
+    resultRows += rows;
+    resultMicros += micros;
+}
+
+void AdaptiveFetchSize::finish(size_t rowWidth)
+{
+    size_t roundTrips = (resultRows + size - 1) / size;
+
+    if (roundTrips > 1) {
+        uint64_t latency = resultMicros / roundTrips;
+        uint64_t bytes = std::min<uint64_t>(std::max<uint64_t>(latency * ADAPTIVE_FETCH_BYTES_PER_MICRO, ADAPTIVE_FETCH_MIN_BYTES),
+                                            ADAPTIVE_FETCH_MAX_BYTES);
+        uint64_t rows = bytes / std::max<size_t>(rowWidth, 1);
+
+        if (rows > (uint64_t)size) {
+            size = (int)std::min<uint64_t>({ rows, (uint64_t)size * 4, ADAPTIVE_FETCH_MAX_ROWS });
+        }
+    }
+
+    resultRows = 0;
+    resultMicros = 0;
+}
@@ -0,0 +1,47 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The range of the rows asked for per round trip, and of the bytes they
+// come to.  A round trip is taken to be worth as many bytes as a link of
+// about 100Mbit/s moves in its time.
+#define ADAPTIVE_FETCH_INITIAL          128
+#define ADAPTIVE_FETCH_MAX_ROWS         65536
+#define ADAPTIVE_FETCH_MIN_BYTES        (64 * 1024)
+#define ADAPTIVE_FETCH_MAX_BYTES        (16 * 1024 * 1024)
+#define ADAPTIVE_FETCH_BYTES_PER_MICRO  16
+
+/**
+ * The fetch size of a statement in adaptive mode.  The time spent
+ * fetching each result is recorded; once it's done, a result that took
+ * more than one round trip gives the latency of one, and the fetch size
+ * for the next execution grows towards the rows of the result's width
+ * that fill a round trip, by at most four times at once.
+ *
+ * The time includes converting the rows, so the latency is overestimated
+ * on a fast network, where the batch has its least size anyway.
+ */
+class AdaptiveFetchSize final
+{
+public:
+    // The fetch size for the next execution, at least a rowset.
+    int  getSize(size_t rowsetSize) const;
+
+    void record(size_t rows, uint64_t micros);
+
+    // The result of rows of rowWidth bytes has been read.
+    void finish(size_t rowWidth);
+
+private:
+    int      size = ADAPTIVE_FETCH_INITIAL;
+    size_t   resultRows = 0;
+    uint64_t resultMicros = 0;
+};
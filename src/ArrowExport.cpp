@@ -0,0 +1,593 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <memory>
+
+#include "ArrowExport.h"
+
+#include "OdbcBase.h"
+#include "DateTime.h"
+#include "OdbcTypeMapper.h"
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/Clob.h"
+#include "NuoRemote/DateClass.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "NuoRemote/TimeClass.h"
+#include "NuoRemote/Timestamp.h"
+
+// The digits a decimal128 holds.
+#define ARROW_DECIMAL_MAX_PRECISION 38
+
+#define MICROS_PER_SECOND 1000000
+
+// The rows of a batch its buffers are sized for before they're read, and
+// the bytes of each variable width value.
+#define ARROW_RESERVED_ROWS     65536
+#define ARROW_RESERVED_BYTES    16
+
+using namespace NuoDB;
+
+namespace ARROW_EXPORT {
+
+using ArrowExport::ArrowColumn;
+using ArrowExport::ArrowKind;
+
+// The buffers of one column of a batch: the validity bitmap, the offsets
+// of a variable width type, and the values.
+struct ColumnBuffers
+{
+    std::vector<uint8_t> validity;
+    std::vector<int64_t> offsets;
+    std::vector<uint8_t> data;
+    int64_t              nullCount = 0;
+    const void*          buffers[3] = { nullptr, nullptr, nullptr };
+};
+
+// What a batch or a schema owns besides its children's own.
+template <typename T>
+struct Children
+{
+    std::vector<T>  children;
+    std::vector<T*> pointers;
+    const void*     buffers[1] = { nullptr };  // a struct array has no validity bitmap
+    std::string     format;
+    std::string     name;
+};
+
+static void releaseColumn(ArrowArray* array)
+{
+    delete (ColumnBuffers*)array->private_data;
+    array->release = nullptr;
+}
+
+// A child that's been moved out has no release callback left.
+static void releaseBatch(ArrowArray* array)
+{
+    auto* owned = (Children<ArrowArray>*)array->private_data;
+    for (ArrowArray& child : owned->children) {
+        if (child.release) {
+            child.release(&child);
+        }
+    }
+    delete owned;
+    array->release = nullptr;
+}
+
+static void releaseSchema(ArrowSchema* schema)
+{
+    auto* owned = (Children<ArrowSchema>*)schema->private_data;
+    for (ArrowSchema& child : owned->children) {
+        if (child.release) {
+            child.release(&child);
+        }
+    }
+    delete owned;
+    schema->release = nullptr;
+}
+
+static void setBit(std::vector<uint8_t>& bits, size_t row, bool value)
+{
+    if (row % 8 == 0) {
+        bits.push_back(0);
+    }
+    if (value) {
+        bits.back() |= (uint8_t)(1 << (row % 8));
+    }
+}
+
+template <typename T>
+static void appendFixed(ColumnBuffers& buffers, T value)
+{
+    size_t end = buffers.data.size();
+    buffers.data.resize(end + sizeof(T));
+    memcpy(&buffers.data[end], &value, sizeof(T));
+}
+
+static void appendBytes(ColumnBuffers& buffers, const void* value, size_t length)
+{
+    size_t end = buffers.data.size();
+    if (length > 0) {
+        buffers.data.resize(end + length);
+        memcpy(&buffers.data[end], value, length);
+    }
+    buffers.offsets.push_back((int64_t)(end + length));
+}
+
+// The unscaled value of the text of a decimal at scale, as the words of a
+// 128 bit two's complement integer, least significant first.  Digits past
+// the scale are dropped.
+static void parseDecimal(const char* text, int scale, uint64_t words[2])
+{
+    uint64_t low = 0;
+    uint64_t high = 0;
+    bool     negative = *text == '-';
+    bool     point = false;
+    int      fraction = 0;
+
+    if (*text == '-' || *text == '+') {
+        ++text;
+    }
+    for (;; ++text) {
+        int digit;
+        if (*text >= '0' && *text <= '9' && (!point || fraction < scale)) {
+            digit = *text - '0';
+            fraction += point;
+        } else if (*text == '.' && !point) {
+            point = true;
+            continue;
+        } else if (*text >= '0' && *text <= '9') {
+            continue;
+        } else if (fraction < scale) {
+            // pad to the scale
+            digit = 0;
+            ++fraction;
+        } else {
+            break;
+        }
+
+        // multiply by ten and add the digit, 32 bits at a time
+        uint64_t lowLow = (low & 0xffffffff) * 10 + (uint64_t)digit;
+        uint64_t lowHigh = (low >> 32) * 10 + (lowLow >> 32);
+        low = (lowHigh << 32) | (lowLow & 0xffffffff);
+        high = high * 10 + (lowHigh >> 32);
+    }
+
+    if (negative) {
+        low = ~low + 1;
+        high = ~high + (low == 0);
+    }
+    words[0] = low;
+    words[1] = high;
+}
+
+// Append the value of column of the current row of results.
+static void appendValue(ResultSet* results, int column, const ArrowColumn& arrow, TimeZoneCache* timeZone,
+                        DateTime::DayMemo* memo, ColumnBuffers& buffers, size_t row)
+{
+    DateTime::Fields fields;
+    bool             valid = true;
+
+    switch (arrow.kind) {
+        case ArrowKind::Boolean: {
+            bool value = results->getBoolean(column);
+            valid = !results->wasNull();
+            setBit(buffers.data, row, valid && value);
+            break;
+        }
+
+        case ArrowKind::Int8:
+            appendFixed<int8_t>(buffers, (int8_t)results->getInt(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Int16:
+            appendFixed<int16_t>(buffers, results->getShort(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Int32:
+            appendFixed<int32_t>(buffers, results->getInt(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Int64:
+            appendFixed<int64_t>(buffers, results->getLong(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Float:
+            appendFixed<float>(buffers, results->getFloat(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Double:
+            appendFixed<double>(buffers, results->getDouble(column));
+            valid = !results->wasNull();
+            break;
+
+        case ArrowKind::Decimal: {
+            uint64_t    words[2] = { 0, 0 };
+            const char* text = results->getString(column);
+            valid = text != nullptr;
+            if (valid) {
+                parseDecimal(text, arrow.scale, words);
+            }
+            appendFixed<uint64_t>(buffers, words[0]);
+            appendFixed<uint64_t>(buffers, words[1]);
+            break;
+        }
+
+        case ArrowKind::Date: {
+            Date*   date = results->getDate(column);
+            int32_t days = 0;
+            valid = date != nullptr;
+            if (valid) {
+                timeZone->toLocal(date->getSeconds(), &fields, memo);
+                date->release();
+                days = (int32_t)DateTime::daysFromCivil(fields.year, fields.month, fields.day);
+            }
+            appendFixed<int32_t>(buffers, days);
+            break;
+        }
+
+        case ArrowKind::Time: {
+            Time*   time = results->getTime(column);
+            int64_t micros = 0;
+            valid = time != nullptr;
+            if (valid) {
+                timeZone->toLocal(time->getSeconds(), &fields, memo);
+                time->release();
+                micros = (int64_t)(fields.hour * 3600 + fields.minute * 60 + fields.second) * MICROS_PER_SECOND;
+            }
+            appendFixed<int64_t>(buffers, micros);
+            break;
+        }
+
+        case ArrowKind::Timestamp: {
+            Timestamp* timestamp = results->getTimestamp(column);
+            int64_t    micros = 0;
+            valid = timestamp != nullptr;
+            if (valid) {
+                micros = timestamp->getSeconds() * MICROS_PER_SECOND + timestamp->getNanos() / 1000;
+                timestamp->release();
+            }
+            appendFixed<int64_t>(buffers, micros);
+            break;
+        }
+
+        case ArrowKind::TimestampNoTZ: {
+            TimestampNoTZ* timestamp = results->getTimestampNoTZ(column);
+            int64_t        micros = 0;
+            valid = timestamp != nullptr;
+            if (valid) {
+                micros = timestamp->getSeconds() * MICROS_PER_SECOND + timestamp->getNanos() / 1000;
+                timestamp->release();
+            }
+            appendFixed<int64_t>(buffers, micros);
+            break;
+        }
+
+        case ArrowKind::String: {
+            int         length = 0;
+            const char* value = results->getString(column, &length);
+            valid = value != nullptr;
+            appendBytes(buffers, value, valid ? (size_t)length : 0);
+            break;
+        }
+
+        case ArrowKind::Binary: {
+            Bytes bytes = results->getBytes(column);
+            valid = !results->wasNull();
+            appendBytes(buffers, bytes.data, valid && bytes.data ? (size_t)bytes.length : 0);
+            break;
+        }
+
+        // the whole of a LOB, read into the data buffer
+        case ArrowKind::Clob:
+        case ArrowKind::Blob: {
+            Blob*  blob = arrow.kind == ArrowKind::Blob ? results->getBlob(column) : nullptr;
+            Clob*  clob = arrow.kind == ArrowKind::Clob ? results->getClob(column) : nullptr;
+            size_t end = buffers.data.size();
+            int    length = blob ? blob->length() : clob ? clob->length() : 0;
+            valid = blob || clob;
+            if (length > 0) {
+                buffers.data.resize(end + length);
+                if (blob) {
+                    blob->getBytes(0, length, &buffers.data[end]);
+                } else {
+                    clob->getChars(0, length, (char*)&buffers.data[end]);
+                }
+            }
+            buffers.offsets.push_back((int64_t)buffers.data.size());
+            if (blob) {
+                blob->release();
+            }
+            if (clob) {
+                clob->release();
+            }
+            break;
+        }
+    }
+
+    setBit(buffers.validity, row, valid);
+    buffers.nullCount += !valid;
+}
+
+static void exportColumn(ColumnBuffers* buffers, const ArrowColumn& arrow, size_t rows, ArrowArray* array)
+{
+    bool variable = ArrowExport::isVariable(arrow.kind);
+
+    buffers->buffers[0] = buffers->nullCount > 0 ? buffers->validity.data() : nullptr;
+    if (variable) {
+        buffers->buffers[1] = buffers->offsets.data();
+        buffers->buffers[2] = buffers->data.data();
+    } else {
+        buffers->buffers[1] = buffers->data.data();
+    }
+
+    array->length = (int64_t)rows;
+    array->null_count = buffers->nullCount;
+    array->offset = 0;
+    array->n_buffers = variable ? 3 : 2;
+    array->n_children = 0;
+    array->buffers = buffers->buffers;
+    array->children = nullptr;
+    array->dictionary = nullptr;
+    array->release = releaseColumn;
+    array->private_data = buffers;
+}
+
+} // namespace ARROW_EXPORT
+
+namespace ArrowExport {
+
+bool isVariable(ArrowKind kind)
+{
+    return kind == ArrowKind::String || kind == ArrowKind::Clob || kind == ArrowKind::Binary || kind == ArrowKind::Blob;
+}
+
+size_t getWidth(ArrowKind kind)
+{
+    switch (kind) {
+        case ArrowKind::Int8:
+            return 1;
+        case ArrowKind::Int16:
+            return 2;
+        case ArrowKind::Int32:
+        case ArrowKind::Float:
+        case ArrowKind::Date:
+            return 4;
+        case ArrowKind::Int64:
+        case ArrowKind::Double:
+        case ArrowKind::Time:
+        case ArrowKind::Timestamp:
+        case ArrowKind::TimestampNoTZ:
+            return 8;
+        case ArrowKind::Decimal:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+std::vector<ArrowColumn> describe(ResultSetMetaData* metaData)
+{
+    int                      count = metaData->getColumnCount();
+    std::vector<ArrowColumn> columns(count);
+
+    for (int n = 1; n <= count; ++n) {
+        ArrowColumn& column = columns[n - 1];
+        const char*  label = metaData->getColumnLabel(n);
+        if (label == nullptr || *label == 0) {
+            label = metaData->getColumnName(n);
+        }
+        column.name = label ? label : "";
+        column.nullable = metaData->isNullable(n);
+
+        int type = metaData->getColumnType(n);
+        switch (type == (int)NUOSQL_BLOB || type == (int)NUOSQL_CLOB ? type : (int)OdbcTypeMapper::mapType(type)) {
+            case (int)NUOSQL_BIT:
+            case (int)NUOSQL_BOOLEAN:
+                column.kind = ArrowKind::Boolean;
+                column.format = "b";
+                break;
+
+            case (int)NUOSQL_TINYINT:
+                column.kind = ArrowKind::Int8;
+                column.format = "c";
+                break;
+
+            case (int)NUOSQL_SMALLINT:
+                column.kind = ArrowKind::Int16;
+                column.format = "s";
+                break;
+
+            case (int)NUOSQL_INTEGER:
+                column.kind = ArrowKind::Int32;
+                column.format = "i";
+                break;
+
+            case (int)NUOSQL_BIGINT:
+                column.kind = ArrowKind::Int64;
+                column.format = "l";
+                break;
+
+            case (int)NUOSQL_REAL:
+                column.kind = ArrowKind::Float;
+                column.format = "f";
+                break;
+
+            case (int)NUOSQL_FLOAT:
+            case (int)NUOSQL_DOUBLE:
+                column.kind = ArrowKind::Double;
+                column.format = "g";
+                break;
+
+            case (int)NUOSQL_NUMERIC:
+            case (int)NUOSQL_DECIMAL: {
+                int precision = metaData->getPrecision(n);
+                int scale = metaData->getScale(n);
+                if (precision > 0 && precision <= ARROW_DECIMAL_MAX_PRECISION && scale >= 0 && scale <= precision) {
+                    column.kind = ArrowKind::Decimal;
+                    column.format = "d:" + std::to_string(precision) + "," + std::to_string(scale);
+                    column.precision = precision;
+                    column.scale = scale;
+                } else {
+                    column.kind = ArrowKind::String;
+                    column.format = "U";
+                }
+                break;
+            }
+
+            case (int)NUOSQL_DATE:
+                column.kind = ArrowKind::Date;
+                column.format = "tdD";
+                break;
+
+            case (int)NUOSQL_TIME:
+                column.kind = ArrowKind::Time;
+                column.format = "ttu";
+                break;
+
+            case (int)NUOSQL_TIMESTAMP:
+                if (DateTime::isWithoutTimeZone(metaData->getColumnTypeName(n))) {
+                    column.kind = ArrowKind::TimestampNoTZ;
+                    column.format = "tsu:";
+                } else {
+                    column.kind = ArrowKind::Timestamp;
+                    column.format = "tsu:UTC";
+                }
+                break;
+
+            case (int)NUOSQL_BINARY:
+            case (int)NUOSQL_VARBINARY:
+            case (int)NUOSQL_LONGVARBINARY:
+                column.kind = ArrowKind::Binary;
+                column.format = "Z";
+                break;
+
+            case (int)NUOSQL_BLOB:
+                column.kind = ArrowKind::Blob;
+                column.format = "Z";
+                break;
+
+            case (int)NUOSQL_CLOB:
+                column.kind = ArrowKind::Clob;
+                column.format = "U";
+                break;
+
+            default:
+                column.kind = ArrowKind::String;
+                column.format = "U";
+                break;
+        }
+    }
+
+    return columns;
+}
+
+void exportSchema(const std::vector<ArrowColumn>& columns, ArrowSchema* schema)
+{
+    auto* owned = new ARROW_EXPORT::Children<ArrowSchema>;
+    owned->format = "+s";
+    owned->children.resize(columns.size());
+    owned->pointers.resize(columns.size());
+
+    for (size_t n = 0; n < columns.size(); ++n) {
+        auto*        names = new ARROW_EXPORT::Children<ArrowSchema>;
+        ArrowSchema& child = owned->children[n];
+        names->format = columns[n].format;
+        names->name = columns[n].name;
+
+        child.format = names->format.c_str();
+        child.name = names->name.c_str();
+        child.metadata = nullptr;
+        child.flags = columns[n].nullable ? ARROW_FLAG_NULLABLE : 0;
+        child.n_children = 0;
+        child.children = nullptr;
+        child.dictionary = nullptr;
+        child.release = ARROW_EXPORT::releaseSchema;
+        child.private_data = names;
+        owned->pointers[n] = &child;
+    }
+
+    schema->format = owned->format.c_str();
+    schema->name = "";
+    schema->metadata = nullptr;
+    schema->flags = 0;
+    schema->n_children = (int64_t)columns.size();
+    schema->children = owned->pointers.data();
+    schema->dictionary = nullptr;
+    schema->release = ARROW_EXPORT::releaseSchema;
+    schema->private_data = owned;
+}
+
+size_t exportBatch(ResultSet* results, const std::vector<ArrowColumn>& columns, TimeZoneCache* timeZone,
+                   size_t maxRows, ArrowArray* batch)
+{
+    // room for a whole batch up front, within reason; every buffer is
+    // allocated, even if the batch turns out to have no data for it
+    size_t expected = std::min<size_t>(maxRows, ARROW_RESERVED_ROWS);
+
+    std::vector<std::unique_ptr<ARROW_EXPORT::ColumnBuffers>> buffers(columns.size());
+    for (size_t n = 0; n < columns.size(); ++n) {
+        buffers[n].reset(new ARROW_EXPORT::ColumnBuffers);
+        ArrowKind kind = columns[n].kind;
+        buffers[n]->validity.reserve((expected + 7) / 8);
+        if (isVariable(kind)) {
+            buffers[n]->offsets.reserve(expected + 1);
+            buffers[n]->offsets.push_back(0);
+            buffers[n]->data.reserve(expected * ARROW_RESERVED_BYTES);
+        } else if (kind == ArrowKind::Boolean) {
+            buffers[n]->data.reserve((expected + 7) / 8);
+        } else {
+            buffers[n]->data.reserve(expected * getWidth(kind));
+        }
+    }
+
+    size_t            rows = 0;
+    DateTime::DayMemo memo;
+    while (rows < maxRows && results->next()) {
+        for (size_t n = 0; n < columns.size(); ++n) {
+            ARROW_EXPORT::appendValue(results, (int)n + 1, columns[n], timeZone, &memo, *buffers[n], rows);
+        }
+        ++rows;
+    }
+
+    if (rows == 0) {
+        return 0;
+    }
+
+    auto* owned = new ARROW_EXPORT::Children<ArrowArray>;
+    owned->children.resize(columns.size());
+    owned->pointers.resize(columns.size());
+    for (size_t n = 0; n < columns.size(); ++n) {
+        ARROW_EXPORT::exportColumn(buffers[n].release(), columns[n], rows, &owned->children[n]);
+        owned->pointers[n] = &owned->children[n];
+    }
+
+    batch->length = (int64_t)rows;
+    batch->null_count = 0;
+    batch->offset = 0;
+    batch->n_buffers = 1;
+    batch->n_children = (int64_t)columns.size();
+    batch->buffers = owned->buffers;
+    batch->children = owned->pointers.data();
+    batch->dictionary = nullptr;
+    batch->release = ARROW_EXPORT::releaseBatch;
+    batch->private_data = owned;
+
+    return rows;
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "NuoODBCArrow.h"
+
+namespace NuoDB {
+class ResultSet;
+class ResultSetMetaData;
+}
+
+class TimeZoneCache;
+
+// Rows of a result set written into Arrow arrays: see NuoODBCArrow.h.
+// The buffers of each column are filled from the result set's getters as
+// its rows are read, and handed over whole; each array owns its buffers
+// and frees them when it's released.
+namespace ArrowExport {
+
+// How the values of a column are read, and what they become.
+enum class ArrowKind : char
+{
+    Boolean,
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    Float,
+    Double,
+    Decimal,        // decimal128 from the text of the value
+    Date,           // days since the epoch
+    Time,           // microseconds since midnight
+    Timestamp,      // microseconds since the epoch, UTC
+    TimestampNoTZ,  // microseconds since the epoch, as a wall clock time
+    String,
+    Clob,
+    Binary,
+    Blob,
+};
+
+struct ArrowColumn
+{
+    ArrowKind   kind = ArrowKind::String;
+    std::string name;
+    std::string format;     // the Arrow format string
+    bool        nullable = true;
+    int         precision = 0;  // Decimal only
+    int         scale = 0;
+};
+
+// Whether values of kind have offsets into a data buffer.
+bool   isVariable(ArrowKind kind);
+
+// The bytes of a value of a fixed width kind, 0 for the rest and the bits
+// of a Boolean.
+size_t getWidth(ArrowKind kind);
+
+std::vector<ArrowColumn> describe(NuoDB::ResultSetMetaData* metaData);
+
+void   exportSchema(const std::vector<ArrowColumn>& columns, ArrowSchema* schema);
+
+// Read up to maxRows rows from results into batch, returning their number;
+// batch is only filled if it's not 0.  Throws SQLException if results do,
+// with nothing left allocated.
+size_t exportBatch(NuoDB::ResultSet* results, const std::vector<ArrowColumn>& columns, TimeZoneCache* timeZone,
+                   size_t maxRows, ArrowArray* batch);
+
+}
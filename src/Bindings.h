@@ -9,18 +9,68 @@
 
 #include "OdbcBase.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "LobFile.h"
+#include "LobStream.h"
+#include "MemoryAccount.h"
 #include "OdbcObject.h"
 
+// State that only a few bindings ever need (parameters sent in pieces with
+// SQLPutData, columns read in pieces with SQLGetData); it's allocated on
+// demand so that Binding stays small.
+struct BindingState
+{
+    // drop the cached column value, it's no longer being read, and the
+    // parameter value, it's been executed with
+    void reset()
+    {
+        if (cached) {
+            std::string().swap(value);
+            std::u16string().swap(wideValue);
+            cached = false;
+        }
+        std::string().swap(accumulator);
+        hexDigit = 0;
+        memory.force(0);
+        lob.close();
+        file.close();
+    }
+
+    // SQLPutData: the value of a parameter put together from its pieces
+    std::string    accumulator;
+
+    // SQLPutData: a binary parameter sent as hex text is decoded into
+    // accumulator a piece at a time; this is the digit a piece ended with
+    // that's waiting for its pair, or 0
+    char           hexDigit = 0;
+
+    // the bytes of accumulator, or of value or wideValue, charged to the
+    // connection
+    MemoryCharge   memory;
+
+    // SQL_C_NUODB_FILE: the file a parameter is set from, mapped while the
+    // statement is executed with it
+    MappedFile     file;
+
+    // SQLGetData: the value of the column in the current row, kept while
+    // the application reads it in pieces
+    std::string    value;
+    std::u16string wideValue;
+    bool           cached = false;
+
+    // SQLGetData: the BLOB in the current row
+    LobStream      lob;
+};
+
 struct Binding
 {
     void reset() { dataAtExecLength = 0; offset = 0; count = 0; }
 
     PTR pointer = nullptr;
     PTR indicatorPointer = nullptr;
-    std::string accumulator;
     SQLLEN bufferLength = 0;
     SQLLEN dataAtExecLength = 0;
     SQLLEN offset = 0;
@@ -38,14 +88,30 @@ public:
 
     int  getCount() const    { return (int)bindings.size(); }
 
-    void alloc(int newCount) { bindings.resize(newCount); }
-    void release()           { bindings.clear(); }
+    void alloc(int newCount)
+    {
+        bindings.resize(newCount);
+        if ((int)states.size() > newCount) {
+            states.resize(newCount);
+        }
+    }
+
+    void release()
+    {
+        bindings.clear();
+        states.clear();
+    }
 
     void reset()
     {
         for (auto& binding : bindings) {
             binding.reset();
         }
+        for (auto& state : states) {
+            if (state) {
+                state->reset();
+            }
+        }
     }
 
     Binding* getBinding(int index)
@@ -56,6 +122,28 @@ public:
         return &bindings[index-1];
     }
 
+    BindingState* getState(int index)
+    {
+        if (index > (int)bindings.size()) {
+            return nullptr;
+        }
+        if (index > (int)states.size()) {
+            states.resize(index);
+        }
+        auto& state = states[index-1];
+        if (!state) {
+            state.reset(new BindingState());
+            state->memory.attach(account, use);
+        }
+        return state.get();
+    }
+
+    // The account the buffers of the states are charged to.
+    void setAccount(MemoryAccount* newAccount, MemoryUse newUse) { account = newAccount; use = newUse; }
+
 private:
+    MemoryAccount* account = nullptr;
+    MemoryUse      use = MemoryUse::Parameters;
     std::vector<Binding> bindings;
+    std::vector<std::unique_ptr<BindingState>> states;
 };
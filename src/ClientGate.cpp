@@ -0,0 +1,66 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include "ClientGate.h"
+
+ClientGate::Use::Use(ClientGate* clientGate)
+    : gate(clientGate)
+{
+    if (gate) {
+        gate->enter();
+    }
+}
+
+ClientGate::Use::~Use()
+{
+    if (gate) {
+        gate->leave();
+    }
+}
+
+void ClientGate::enter()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    ++calls;
+    changed.wait(lock, [this] { return !producing; });
+}
+
+void ClientGate::leave()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --calls;
+    }
+    changed.notify_all();
+}
+
+bool ClientGate::enterProducer(const std::atomic<bool>& stopping)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [&] { return stopping || (calls == 0 && !producing); });
+    if (stopping) {
+        return false;
+    }
+    producing = true;
+    return true;
+}
+
+void ClientGate::leaveProducer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        producing = false;
+    }
+    changed.notify_all();
+}
+
+void ClientGate::wake()
+{
+    // taking the mutex orders this after the producer's check of stopping
+    std::lock_guard<std::mutex> lock(mutex);
+    changed.notify_all();
+}
@@ -0,0 +1,56 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * Takes turns on a connection's NuoDB client connection, which isn't made
+ * to be used from two threads at once, between the application's calls on
+ * the connection and its statements and the threads that read rows ahead
+ * for prefetched result sets.
+ *
+ * The application comes first: a producer reads a row only while no call
+ * is in progress, and a call waits at most for the one row a producer is
+ * reading when it starts.  Calls aren't serialized among themselves.
+ */
+class ClientGate final
+{
+public:
+    // An application call, for as long as it's in scope.  A null gate is
+    // a connection without one.
+    class Use final
+    {
+    public:
+        explicit Use(ClientGate* gate);
+        ~Use();
+
+        Use(const Use&) = delete;
+        Use& operator=(const Use&) = delete;
+
+    private:
+        ClientGate* gate;
+    };
+
+    void enter();
+    void leave();
+
+    // A producer, around each use of the client.  Returns false, without
+    // entering, once stopping is set; wake() has a waiting producer see it.
+    bool enterProducer(const std::atomic<bool>& stopping);
+    void leaveProducer();
+    void wake();
+
+private:
+    std::mutex              mutex;
+    std::condition_variable changed;
+    int                     calls = 0;
+    bool                    producing = false;
+};
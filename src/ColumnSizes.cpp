@@ -0,0 +1,200 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ColumnSizes.h"
+
+#include "OdbcTypeMapper.h"
+
+#include "NuoRemote/DatabaseMetaData.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "SQLException.h"
+
+using namespace NuoDB;
+
+namespace COLUMN_SIZES {
+
+static bool isText(int sqlType)
+{
+    return sqlType == (int)NUOSQL_CHAR || sqlType == (int)NUOSQL_VARCHAR;
+}
+
+static bool isBinary(int sqlType)
+{
+    return sqlType == (int)NUOSQL_BINARY || sqlType == (int)NUOSQL_VARBINARY;
+}
+
+// STRING has no length to declare.
+static bool isUnbounded(const char* typeName)
+{
+    return typeName && strcasecmp(typeName, "STRING") == 0;
+}
+
+// The n of a type name such as "VARCHAR(n)", or 0.
+static int parseLength(const char* typeName)
+{
+    const char* open = typeName ? strchr(typeName, '(') : nullptr;
+    return open ? atoi(open + 1) : 0;
+}
+
+// The bytes of a value of a fixed size type in its default C type, or 0.
+static SQLLEN getFixedOctetLength(int sqlType, int precision)
+{
+    switch (sqlType) {
+        case (int)NUOSQL_BIT:
+        case (int)NUOSQL_BOOLEAN:
+        case (int)NUOSQL_TINYINT:
+            return 1;
+
+        case (int)NUOSQL_SMALLINT:
+            return 2;
+
+        case (int)NUOSQL_INTEGER:
+        case (int)NUOSQL_REAL:
+            return 4;
+
+        case (int)NUOSQL_BIGINT:
+        case (int)NUOSQL_FLOAT:
+        case (int)NUOSQL_DOUBLE:
+            return 8;
+
+        case (int)NUOSQL_NUMERIC:
+        case (int)NUOSQL_DECIMAL:
+            // the digits, a sign, and a decimal point
+            return precision > 0 ? precision + 2 : 0;
+
+        case (int)NUOSQL_DATE:
+            return sizeof(SQL_DATE_STRUCT);
+
+        case (int)NUOSQL_TIME:
+            return sizeof(SQL_TIME_STRUCT);
+
+        case (int)NUOSQL_TIMESTAMP:
+            return sizeof(SQL_TIMESTAMP_STRUCT);
+
+        default:
+            return 0;
+    }
+}
+
+} // namespace COLUMN_SIZES
+
+void ColumnSizes::invalidate()
+{
+    sizes.clear();
+    resolved.clear();
+    tables.clear();
+}
+
+ColumnSize ColumnSizes::get(DatabaseMetaData* catalog, ResultSetMetaData* metaData, int column)
+{
+    int count = metaData->getColumnCount();
+    if (column < 1 || column > count) {
+        // left to the metadata to complain about
+        return resolve(catalog, metaData, column);
+    }
+
+    if (resolved.empty()) {
+        sizes.resize(count + 1);
+        resolved.assign(count + 1, false);
+    }
+    if (!resolved[column]) {
+        sizes[column] = resolve(catalog, metaData, column);
+        resolved[column] = true;
+    }
+
+    return sizes[column];
+}
+
+ColumnSize ColumnSizes::resolve(DatabaseMetaData* catalog, ResultSetMetaData* metaData, int column)
+{
+    ColumnSize size;
+    size.sqlType = (int)OdbcTypeMapper::mapType(metaData->getColumnType(column));
+    int precision = metaData->getPrecision(column);
+
+    if (COLUMN_SIZES::isText(size.sqlType) || COLUMN_SIZES::isBinary(size.sqlType)) {
+        int length = getDeclaredLength(catalog, metaData, column);
+        if (length > 0) {
+            bool text = COLUMN_SIZES::isText(size.sqlType);
+            size.columnSize = length;
+            size.length = length;
+            size.octetLength = text ? (SQLLEN)length * COLUMN_SIZES_MAX_CHAR_BYTES : length;
+            size.displaySize = text ? length : (SQLLEN)length * 2;
+            return size;
+        }
+        if (COLUMN_SIZES::isText(size.sqlType)) {
+            size.sqlType = (int)NUOSQL_LONGVARCHAR;
+        }
+    }
+
+    // whatever the server says of the rest
+    SQLLEN maxLength = metaData->getCurrentColumnMaxLength(column);
+    SQLLEN octetLength = COLUMN_SIZES::getFixedOctetLength(size.sqlType, precision);
+    size.columnSize = precision;
+    size.length = maxLength;
+    size.octetLength = octetLength > 0 ? octetLength : maxLength;
+    size.displaySize = maxLength;
+    return size;
+}
+
+// The length a character or binary column was declared with, or 0 if it
+// has none or it can't be found.
+int ColumnSizes::getDeclaredLength(DatabaseMetaData* catalog, ResultSetMetaData* metaData, int column)
+{
+    const char* typeName = metaData->getColumnTypeName(column);
+    if (COLUMN_SIZES::isUnbounded(typeName)) {
+        return 0;
+    }
+
+    // not the longest value in the result, which would change with the data
+    int length = metaData->getPrecision(column);
+    if (length <= 0) {
+        length = COLUMN_SIZES::parseLength(typeName);
+    }
+    if (length > 0 || !catalog) {
+        return length > 0 ? length : 0;
+    }
+
+    // an expression has no table to look in
+    std::string schema = metaData->getSchemaName(column);
+    std::string table = metaData->getTableName(column);
+    if (table.empty()) {
+        return 0;
+    }
+
+    std::string key = schema + '.' + table;
+    auto        found = tables.find(key);
+    if (found == tables.end()) {
+        auto&      columns = tables[key];
+        ResultSet* results = nullptr;
+        try {
+            results = catalog->getColumns(nullptr, schema.empty() ? nullptr : schema.c_str(), table.c_str(), nullptr);
+            while (results->next()) {
+                // the table name is a pattern, so others may match it
+                const char* name = results->getString(3);
+                const char* columnName = results->getString(4);
+                if (name && columnName && table == name) {
+                    columns[columnName] = results->getInt(7);
+                }
+            }
+            results->close();
+        } catch (SQLException&) {
+            // the length stays unknown
+            if (results) {
+                results->close();
+            }
+        }
+        found = tables.find(key);
+    }
+
+    const char* name = metaData->getColumnName(column);
+    auto        declared = found->second.find(name ? name : "");
+    return declared != found->second.end() && declared->second > 0 ? declared->second : 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "OdbcBase.h"
+
+namespace NuoDB {
+class DatabaseMetaData;
+class ResultSetMetaData;
+}
+
+// The most bytes a character takes, in UTF-8 as well as in UTF-16 (a
+// character outside the BMP is a surrogate pair).
+#define COLUMN_SIZES_MAX_CHAR_BYTES 4
+
+// What SQLDescribeCol and SQLColAttribute report of the size of a column.
+struct ColumnSize
+{
+    int     sqlType = 0;      // CHAR and VARCHAR of no known length are LONGVARCHAR
+    SQLULEN columnSize = 0;   // characters of text, bytes of binary, the precision of the rest
+    SQLLEN  length = 0;       // SQL_DESC_LENGTH
+    SQLLEN  octetLength = 0;  // bytes of the longest value in its default C type
+    SQLLEN  displaySize = 0;
+};
+
+/**
+ * The sizes of the columns of a statement's result set, worked out the
+ * first time each is asked for.  The declared length of a character or
+ * binary column is taken from its precision, the length in its type name,
+ * or else from the catalog, which is read once for each table, so that it
+ * is the same at prepare and execute whatever the data; only a column none
+ * of them know the length of, or of an unbounded type such as STRING, is
+ * reported as LONGVARCHAR.
+ *
+ * The sizes have to be invalidated whenever the statement's metadata
+ * changes.
+ */
+class ColumnSizes final
+{
+public:
+    void       invalidate();
+
+    // Throws SQLException if metaData does.
+    ColumnSize get(NuoDB::DatabaseMetaData* catalog, NuoDB::ResultSetMetaData* metaData, int column);
+
+private:
+    ColumnSize resolve(NuoDB::DatabaseMetaData* catalog, NuoDB::ResultSetMetaData* metaData, int column);
+    int        getDeclaredLength(NuoDB::DatabaseMetaData* catalog, NuoDB::ResultSetMetaData* metaData, int column);
+
+    std::vector<ColumnSize> sizes;
+    std::vector<bool>       resolved;
+
+    // the COLUMN_SIZE of the columns of each table looked up, by name
+    std::unordered_map<std::string, std::unordered_map<std::string, int>> tables;
+};
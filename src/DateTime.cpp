@@ -0,0 +1,184 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <time.h>
+#include <string.h>
+
+#include "DateTime.h"
+
+#include "OdbcBase.h"
+
+/* Default to the POSIX API; make Windows groks it. */
+#ifdef _WIN32
+# define localtime_r(_t, _r) localtime_s(_r, _t)
+#endif
+
+#define SECONDS_PER_DAY 86400
+
+namespace DATE_TIME {
+
+static int64_t floorDiv(int64_t value, int64_t divisor)
+{
+    int64_t quotient = value / divisor;
+    return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
+} // namespace DATE_TIME
+
+namespace DateTime {
+
+// See Howard Hinnant, "chrono-Compatible Low-Level Date Algorithms".
+int64_t daysFromCivil(int64_t year, unsigned month, unsigned day)
+{
+    year -= month <= 2;
+    const int64_t  era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yearOfEra = (unsigned)(year - era * 400);
+    const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int64_t)dayOfEra - 719468;
+}
+
+void civilFromDays(int64_t days, int64_t* year, unsigned* month, unsigned* day)
+{
+    days += 719468;
+    const int64_t  era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned dayOfEra = (unsigned)(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned monthPrime = (5 * dayOfYear + 2) / 153;
+
+    *day = dayOfYear - (153 * monthPrime + 2) / 5 + 1;
+    *month = monthPrime < 10 ? monthPrime + 3 : monthPrime - 9;
+    *year = (int64_t)yearOfEra + era * 400 + (*month <= 2);
+}
+
+void fromSeconds(int64_t seconds, Fields* fields)
+{
+    int64_t days = DATE_TIME::floorDiv(seconds, SECONDS_PER_DAY);
+    int64_t secondOfDay = seconds - days * SECONDS_PER_DAY;
+
+    civilFromDays(days, &fields->year, &fields->month, &fields->day);
+    fields->hour = (unsigned)(secondOfDay / 3600);
+    fields->minute = (unsigned)(secondOfDay / 60 % 60);
+    fields->second = (unsigned)(secondOfDay % 60);
+}
+
+bool isWithoutTimeZone(const char* typeName)
+{
+    static const char suffix[] = "WITHOUT TIME ZONE";
+    size_t length = typeName ? strlen(typeName) : 0;
+    return length >= sizeof(suffix) - 1 && strcasecmp(typeName + length - (sizeof(suffix) - 1), suffix) == 0;
+}
+
+}
+
+int TimeZoneCache::systemOffset(int64_t seconds)
+{
+    time_t    time_secs = (time_t)seconds;
+    struct tm local_time;
+    localtime_r(&time_secs, &local_time);
+
+    int64_t local = DateTime::daysFromCivil(local_time.tm_year + 1900, local_time.tm_mon + 1, local_time.tm_mday) * SECONDS_PER_DAY
+        + local_time.tm_hour * 3600 + local_time.tm_min * 60 + local_time.tm_sec;
+
+    return (int)(local - seconds);
+}
+
+// The slot a day's offsets are kept in: consecutive days use different
+// slots, so a scan over a range of dates fills the table before it starts
+// replacing days.
+static size_t slotOf(int64_t day, size_t slots)
+{
+    return (size_t)((uint64_t)day % slots);
+}
+
+bool TimeZoneCache::find(int64_t day, DayOffsets* offsets) const
+{
+    const Slot& slot = slots[slotOf(day, sizeof(slots) / sizeof(slots[0]))];
+
+    uint32_t version = slot.version.load(std::memory_order_acquire);
+    if (version & 1) {
+        return false;
+    }
+    bool found = slot.day.load(std::memory_order_relaxed) == day;
+    offsets->before = slot.before.load(std::memory_order_relaxed);
+    offsets->after = slot.after.load(std::memory_order_relaxed);
+    offsets->transition = slot.transition.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return found && slot.version.load(std::memory_order_relaxed) == version;
+}
+
+TimeZoneCache::DayOffsets TimeZoneCache::lookup(int64_t day)
+{
+    DayOffsets offsets;
+    if (find(day, &offsets)) {
+        return offsets;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (find(day, &offsets)) {
+        return offsets;
+    }
+
+    int64_t start = day * SECONDS_PER_DAY;
+    offsets.before = systemOffset(start);
+    offsets.after = systemOffset(start + SECONDS_PER_DAY - 1);
+    offsets.transition = SECONDS_PER_DAY;
+
+    if (offsets.after != offsets.before) {
+        // find the first second on the new offset
+        int low = 0;
+        int high = SECONDS_PER_DAY - 1;
+        while (high - low > 1) {
+            int middle = low + (high - low) / 2;
+            if (systemOffset(start + middle) == offsets.before) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        offsets.transition = high;
+    }
+
+    // the day replaces whatever was in its slot
+    Slot&    slot = slots[slotOf(day, sizeof(slots) / sizeof(slots[0]))];
+    uint32_t version = slot.version.load(std::memory_order_relaxed);
+    slot.version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.day.store(day, std::memory_order_relaxed);
+    slot.before.store(offsets.before, std::memory_order_relaxed);
+    slot.after.store(offsets.after, std::memory_order_relaxed);
+    slot.transition.store(offsets.transition, std::memory_order_relaxed);
+    slot.version.store(version + 2, std::memory_order_release);
+
+    return offsets;
+}
+
+void TimeZoneCache::toLocal(int64_t seconds, DateTime::Fields* fields, DateTime::DayMemo* memo)
+{
+    int64_t    utcDay = DATE_TIME::floorDiv(seconds, SECONDS_PER_DAY);
+    DayOffsets offsets = lookup(utcDay);
+    int64_t    local = seconds + ((seconds - utcDay * SECONDS_PER_DAY < offsets.transition) ? offsets.before : offsets.after);
+    int64_t    localDay = DATE_TIME::floorDiv(local, SECONDS_PER_DAY);
+    int64_t    secondOfDay = local - localDay * SECONDS_PER_DAY;
+
+    if (!memo) {
+        DateTime::civilFromDays(localDay, &fields->year, &fields->month, &fields->day);
+    } else {
+        if (memo->day != localDay) {
+            DateTime::civilFromDays(localDay, &memo->year, &memo->month, &memo->dayOfMonth);
+            memo->day = localDay;
+        }
+        fields->year = memo->year;
+        fields->month = memo->month;
+        fields->day = memo->dayOfMonth;
+    }
+    fields->hour = (unsigned)(secondOfDay / 3600);
+    fields->minute = (unsigned)(secondOfDay / 60 % 60);
+    fields->second = (unsigned)(secondOfDay % 60);
+}
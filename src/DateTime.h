@@ -0,0 +1,91 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+
+// Calendar arithmetic for DATE, TIME and TIMESTAMP values.  The NuoDB client
+// hands those out as seconds since the epoch; converting them with
+// localtime_r for every cell serializes all threads on the C library's
+// timezone lock, so the conversion is done here with integer arithmetic.
+namespace DateTime {
+
+struct Fields
+{
+    int64_t  year;
+    unsigned month;
+    unsigned day;
+    unsigned hour;
+    unsigned minute;
+    unsigned second;
+};
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar, and back.
+int64_t daysFromCivil(int64_t year, unsigned month, unsigned day);
+void    civilFromDays(int64_t days, int64_t* year, unsigned* month, unsigned* day);
+
+// Split seconds since the epoch into UTC calendar fields.
+void    fromSeconds(int64_t seconds, Fields* fields);
+
+// Whether a column type name is that of a TIMESTAMP WITHOUT TIME ZONE.
+bool    isWithoutTimeZone(const char* typeName);
+
+// The calendar fields of the last local day converted, kept by a caller
+// converting many values in turn, since rows tend to repeat dates.  Each
+// thread converting needs its own.
+struct DayMemo
+{
+    int64_t  day = INT64_MIN;
+    int64_t  year = 0;
+    unsigned month = 0;
+    unsigned dayOfMonth = 0;
+};
+
+}
+
+// The local UTC offset of the UTC days looked up, including where in the
+// day a DST transition falls, so that localtime_r is only called for a day
+// the first time it's seen.  One per connection, shared by the threads
+// converting its rows: a day is found without taking a lock, and only a
+// day that isn't there takes the mutex to be added.
+class TimeZoneCache final
+{
+public:
+    // Split seconds since the epoch into local calendar fields, with memo,
+    // if there is one, saving the calendar arithmetic for a repeated day.
+    void toLocal(int64_t seconds, DateTime::Fields* fields, DateTime::DayMemo* memo = nullptr);
+
+private:
+    struct DayOffsets
+    {
+        int before;     // offset from the start of the day...
+        int after;      // ...and from 'transition' seconds into it on
+        int transition;
+    };
+
+    // A day's offsets, for the days that map to it.  The version is odd
+    // while a writer changes the slot; a reader that sees it change, or
+    // odd, looks the day up again under the mutex.
+    struct Slot
+    {
+        std::atomic<uint32_t> version { 0 };
+        std::atomic<int64_t>  day { INT64_MIN };
+        std::atomic<int>      before { 0 };
+        std::atomic<int>      after { 0 };
+        std::atomic<int>      transition { 0 };
+    };
+
+    static int systemOffset(int64_t seconds);
+    bool       find(int64_t day, DayOffsets* offsets) const;
+    DayOffsets lookup(int64_t day);
+
+    std::mutex mutex;
+    Slot       slots[1024];
+};
@@ -28,4 +28,6 @@ public:
     int         scale = 0;
     int         bufferLength = 0;
     bool        nullable = false;
+    bool        precisionSet = false;   // by the application, even to 0
+    bool        scaleSet = false;
 };
@@ -0,0 +1,998 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "FetchPlan.h"
+
+#include "Bindings.h"
+#include "DateTime.h"
+#include "HexCodec.h"
+#include "LobFile.h"
+#include "LobStream.h"
+#include "Numeric.h"
+#include "OdbcDesc.h"
+#include "OdbcError.h"
+#include "OdbcObject.h"
+#include "OdbcStatement.h"
+#include "OdbcTypeMapper.h"
+#include "Transcoder.h"
+#include "WorkerPool.h"
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/DateClass.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "NuoRemote/TimeClass.h"
+#include "NuoRemote/Timestamp.h"
+#include "SQLException.h"
+
+using namespace NuoDB;
+
+// Rows converted by one task, at least: below this the hand-off costs more
+// than it saves.
+#define MIN_ROWS_PER_TASK 256
+
+namespace FETCH_PLAN {
+
+static int truncated(OdbcObject* owner, int column, SQLLEN needed, SQLLEN copied)
+{
+    std::ostringstream msg;
+    msg << "Data truncated on column " << column << ", need length " << needed << " only have " << copied;
+    owner->postError("01004", msg.str());
+    return SQL_SUCCESS_WITH_INFO;
+}
+
+static int invalidLength(OdbcObject* owner)
+{
+    owner->postError("HY090", "Invalid string or buffer length");
+    return SQL_ERROR;
+}
+
+static void setIndicator(SQLLEN* indicator, SQLLEN value)
+{
+    if (indicator) {
+        *indicator = value;
+    }
+}
+
+// The length of a character or binary value once SQL_ATTR_MAX_LENGTH is
+// applied.
+static SQLLEN capLength(const FetchColumn& column, SQLLEN length)
+{
+    return (column.maxLength > 0 && length > (SQLLEN)column.maxLength) ? (SQLLEN)column.maxLength : length;
+}
+
+static int fetchChar(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    int         ret = SQL_SUCCESS;
+    int         length = 0;
+    const char* string = results->getString(column.column, &length);
+    SQLLEN      stringLen = string == NULL ? 0 : capLength(column, length);
+    SQLLEN      copied = std::max<SQLLEN>(0, std::min<SQLLEN>(column.bufferLength - 1, stringLen));
+
+    if (copied > 0) {
+        memcpy(data, string, copied);
+    }
+    if (copied != stringLen) {
+        ret = truncated(owner, column.column, stringLen, copied);
+    }
+    if (column.bufferLength > 0) {
+        data[copied] = 0;
+    }
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : copied);
+    return ret;
+}
+
+static int fetchWChar(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    int         ret = SQL_SUCCESS;
+    int         length = 0;
+    const char* string = results->getString(column.column, &length);
+    // transcode straight into the buffer, leaving room for a 2 byte null terminator
+    size_t      capacity = column.bufferLength >= 2 ? (column.bufferLength - 2) / 2 : 0;
+    size_t      written = 0;
+    size_t      required = 0;
+
+    if (string && !Transcoder::utf8ToUtf16(string, length, (char16_t*)data, capacity, &written, &required)) {
+        owner->postError("HY000", "invalid UTF-8 code sequence");
+        return SQL_ERROR;
+    }
+    if (column.maxLength > 0) {
+        // a capped value is cut short silently
+        required = std::min<size_t>(required, column.maxLength / 2);
+        written = std::min(written, required);
+    }
+    if (written != required) {
+        ret = truncated(owner, column.column, 2 * required, 2 * written);
+    }
+    if (column.bufferLength >= 2) {
+        ((char16_t*)data)[written] = 0;
+    }
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)(2 * written));
+    return ret;
+}
+
+// Typed columns read as text are written by the driver; see TextFormat.
+static int fetchFormattedChar(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    char   text[TEXT_FORMAT_MAX];
+    int    ret = SQL_SUCCESS;
+    int    length = TextFormat::formatColumn(results, column.column, column.text, column.timeZone, text, &column.memo);
+    if (length < 0) {
+        setIndicator(indicator, SQL_NULL_DATA);
+        return SQL_SUCCESS;
+    }
+
+    SQLLEN stringLen = capLength(column, length);
+    SQLLEN copied = std::max<SQLLEN>(0, std::min<SQLLEN>(column.bufferLength - 1, stringLen));
+
+    memcpy(data, text, copied);
+    if (copied != stringLen) {
+        ret = truncated(owner, column.column, stringLen, copied);
+    }
+    if (column.bufferLength > 0) {
+        data[copied] = 0;
+    }
+
+    setIndicator(indicator, copied);
+    return ret;
+}
+
+static int fetchFormattedWChar(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    char   text[TEXT_FORMAT_MAX];
+    int    ret = SQL_SUCCESS;
+    int    length = TextFormat::formatColumn(results, column.column, column.text, column.timeZone, text, &column.memo);
+    if (length < 0) {
+        setIndicator(indicator, SQL_NULL_DATA);
+        return SQL_SUCCESS;
+    }
+
+    // the text is ASCII: one unit per byte
+    SQLLEN required = column.maxLength > 0 ? std::min<SQLLEN>(length, column.maxLength / 2) : length;
+    SQLLEN capacity = column.bufferLength >= 2 ? (column.bufferLength - 2) / 2 : 0;
+    SQLLEN written = std::min(required, capacity);
+
+    char16_t* out = (char16_t*)data;
+    for (SQLLEN n = 0; n < written; ++n) {
+        out[n] = (char16_t)text[n];
+    }
+    if (written != required) {
+        ret = truncated(owner, column.column, 2 * required, 2 * written);
+    }
+    if (column.bufferLength >= 2) {
+        out[written] = 0;
+    }
+
+    setIndicator(indicator, 2 * written);
+    return ret;
+}
+
+static int fetchBinary(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    int       ret = SQL_SUCCESS;
+    LobStream lob;
+    lob.open(results->getBlob(column.column), column.maxLength, false);
+    SQLLEN    length = lob.getLength();
+    SQLLEN    copied = std::min<SQLLEN>(column.bufferLength, length);
+
+    if (copied > 0) {
+        lob.read(0, data, copied);
+    }
+    if (copied != length) {
+        ret = truncated(owner, column.column, length, copied);
+    }
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : copied);
+    return ret;
+}
+
+// BINARY and VARBINARY values come with the row: copy them straight out
+// rather than through a Blob.
+static int fetchBytes(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    int    ret = SQL_SUCCESS;
+    Bytes  bytes = results->getBytes(column.column);
+    SQLLEN length = bytes.data ? capLength(column, bytes.length) : 0;
+    SQLLEN copied = std::min<SQLLEN>(column.bufferLength, length);
+
+    if (copied > 0) {
+        memcpy(data, bytes.data, copied);
+    }
+    if (copied != length) {
+        ret = truncated(owner, column.column, length, copied);
+    }
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : copied);
+    return ret;
+}
+
+// BINARY, VARBINARY and BLOB values read as SQL_C_CHAR: two hex digits a
+// byte, encoded straight into the buffer.
+static int fetchHex(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    if (column.bufferLength < 0) {
+        return invalidLength(owner);
+    }
+
+    int    ret = SQL_SUCCESS;
+    SQLLEN length;
+    SQLLEN copied;
+
+    if (OdbcTypeMapper::isInlineBinary(column.sqlType)) {
+        Bytes bytes = results->getBytes(column.column);
+        length = bytes.data ? capLength(column, 2 * (SQLLEN)bytes.length) : 0;
+        copied = std::max<SQLLEN>(0, std::min<SQLLEN>(column.bufferLength - 1, length));
+        HexCodec::encodeDigits(bytes.data, 0, copied, data);
+    } else {
+        // only the bytes of the digits that fit are read
+        LobStream lob;
+        lob.open(results->getBlob(column.column), column.maxLength > 0 ? (column.maxLength + 1) / 2 : 0, false);
+        length = capLength(column, 2 * lob.getLength());
+        copied = std::max<SQLLEN>(0, std::min<SQLLEN>(column.bufferLength - 1, length));
+        if (copied > 0) {
+            std::vector<char> bytes((copied + 1) / 2);
+            lob.read(0, bytes.data(), (SQLLEN)bytes.size());
+            HexCodec::encodeDigits((const uint8_t*)bytes.data(), 0, copied, data);
+        }
+    }
+
+    if (copied != length) {
+        ret = truncated(owner, column.column, length, copied);
+    }
+    if (column.bufferLength > 0) {
+        data[copied] = 0;
+    }
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : copied);
+    return ret;
+}
+
+// The whole value, written to the file named in the bound buffer.
+static int fetchFile(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    const char* path = LobFile::getPath(data, column.bufferLength);
+    if (!path) {
+        return invalidLength(owner);
+    }
+
+    SQLLEN written = 0;
+    if (!LobFile::writeColumn(results, column.column, column.sqlType, column.maxLength, path, &written)) {
+        std::ostringstream message;
+        message << "Cannot write " << path << ": " << strerror(errno);
+        owner->postError("HY000", message.str());
+        return SQL_ERROR;
+    }
+
+    setIndicator(indicator, written);
+    return SQL_SUCCESS;
+}
+
+// These map to SQLSMALLINT, SQLINTEGER, etc.: use the fixed size types so
+// that we don't write 8 bytes for a long on 64 bit unix boxes.
+static int fetchShort(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *(short*)data = results->getShort(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(short));
+    return SQL_SUCCESS;
+}
+
+static int fetchInt(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *(int*)data = results->getInt(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(int));
+    return SQL_SUCCESS;
+}
+
+static int fetchFloat(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *(float*)data = results->getFloat(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(float));
+    return SQL_SUCCESS;
+}
+
+static int fetchDouble(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *(double*)data = results->getDouble(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(double));
+    return SQL_SUCCESS;
+}
+
+static int fetchTinyInt(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *data = results->getByte(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(char));
+    return SQL_SUCCESS;
+}
+
+static int fetchBigInt(OdbcObject*, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    *(int64_t*)data = results->getLong(column.column);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(int64_t));
+    return SQL_SUCCESS;
+}
+
+// A prefetched result set has no date/time object to hand out for a column
+// of another type (see PrefetchResultSet).
+static int noDateTime(OdbcObject* owner, ResultSet* results, const FetchColumn& column, SQLLEN* indicator)
+{
+    if (results->wasNull()) {
+        setIndicator(indicator, SQL_NULL_DATA);
+        return SQL_SUCCESS;
+    }
+
+    std::ostringstream message;
+    message << "Restricted data type attribute violation, type " << column.cType << " on column " << column.column;
+    owner->postError("07006", message.str());
+    return SQL_ERROR;
+}
+
+static int fetchDate(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    Date*            date = results->getDate(column.column);
+    if (!date) {
+        return noDateTime(owner, results, column, indicator);
+    }
+    DateTime::Fields fields;
+    column.timeZone->toLocal(date->getSeconds(), &fields, &column.memo);
+    date->release();
+
+    tagDATE_STRUCT* var = (tagDATE_STRUCT*)data;
+    var->year = (SQLSMALLINT)fields.year;
+    var->month = fields.month;
+    var->day = fields.day;
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(tagDATE_STRUCT));
+    return SQL_SUCCESS;
+}
+
+static void setTimestamp(tagTIMESTAMP_STRUCT* var, const DateTime::Fields& fields, uint32_t nanos)
+{
+    var->year = (SQLSMALLINT)fields.year;
+    var->month = fields.month;
+    var->day = fields.day;
+    var->hour = fields.hour;
+    var->minute = fields.minute;
+    var->second = fields.second;
+    var->fraction = nanos;  // the ODBC fraction is in nanoseconds too
+}
+
+static int fetchTimestamp(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    Timestamp*           timestamp = results->getTimestamp(column.column);
+    if (!timestamp) {
+        return noDateTime(owner, results, column, indicator);
+    }
+    DateTime::Fields     fields;
+    column.timeZone->toLocal(timestamp->getSeconds(), &fields, &column.memo);
+    uint32_t             nanos = timestamp->getNanos();
+    timestamp->release();
+
+    setTimestamp((tagTIMESTAMP_STRUCT*)data, fields, nanos);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(tagTIMESTAMP_STRUCT));
+    return SQL_SUCCESS;
+}
+
+// A TIMESTAMP WITHOUT TIME ZONE carries its wall clock fields as they are,
+// so there's no local time to work out.
+static int fetchTimestampNoTZ(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    TimestampNoTZ*       timestamp = results->getTimestampNoTZ(column.column);
+    if (!timestamp) {
+        return noDateTime(owner, results, column, indicator);
+    }
+    DateTime::Fields     fields;
+    DateTime::fromSeconds(timestamp->getSeconds(), &fields);
+    uint32_t             nanos = timestamp->getNanos();
+    timestamp->release();
+
+    setTimestamp((tagTIMESTAMP_STRUCT*)data, fields, nanos);
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(tagTIMESTAMP_STRUCT));
+    return SQL_SUCCESS;
+}
+
+static int fetchTime(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    Time*            time = results->getTime(column.column);
+    if (!time) {
+        return noDateTime(owner, results, column, indicator);
+    }
+    DateTime::Fields fields;
+    column.timeZone->toLocal(time->getSeconds(), &fields, &column.memo);
+    time->release();
+
+    tagTIME_STRUCT* var = (tagTIME_STRUCT*)data;
+    var->hour = fields.hour;
+    var->minute = fields.minute;
+    var->second = fields.second;
+
+    setIndicator(indicator, results->wasNull() ? SQL_NULL_DATA : (SQLLEN)sizeof(tagTIME_STRUCT));
+    return SQL_SUCCESS;
+}
+
+static int fetchNumeric(OdbcObject* owner, ResultSet* results, const FetchColumn& column, char* data, SQLLEN* indicator)
+{
+    int         length = 0;
+    const char* string = results->getString(column.column, &length);
+    if (!string || results->wasNull()) {
+        setIndicator(indicator, SQL_NULL_DATA);
+        return SQL_SUCCESS;
+    }
+
+    Numeric::Status status = Numeric::fromString(string, length, column.precision, column.scale, (SQL_NUMERIC_STRUCT*)data);
+    if (status == Numeric::Status::Ok) {
+        setIndicator(indicator, sizeof(SQL_NUMERIC_STRUCT));
+        return SQL_SUCCESS;
+    }
+
+    owner->postError(Numeric::getSqlState(status), Numeric::getMessage(status));
+    if (status != Numeric::Status::FractionTruncated) {
+        return SQL_ERROR;
+    }
+    setIndicator(indicator, sizeof(SQL_NUMERIC_STRUCT));
+    return SQL_SUCCESS_WITH_INFO;
+}
+
+static int fetchUnsupported(OdbcObject* owner, ResultSet*, const FetchColumn& column, char*, SQLLEN*)
+{
+    std::ostringstream message;
+    message << "Optional feature not implemented, type " << column.cType << " not supported on column " << column.column;
+    owner->postError(new OdbcError(0, "HY000", message.str()));
+    return SQL_ERROR;
+}
+
+// Pick the converter for cType and return the size of one value in a
+// column-wise bound array.
+static FetchConverter getConverter(int cType, SQLLEN bufferLength, SQLLEN* elementSize, FetchKind* kind)
+{
+    *kind = FetchKind::Converter;
+
+    switch (cType) {
+        case SQL_C_CHAR:
+            *elementSize = bufferLength;
+            return fetchChar;
+
+        case SQL_C_WCHAR:
+            *elementSize = bufferLength;
+            return fetchWChar;
+
+        case SQL_C_BINARY:
+            *elementSize = bufferLength;
+            return fetchBinary;
+
+        case SQL_C_SSHORT:
+        case SQL_C_USHORT:
+        case SQL_C_SHORT:
+            *elementSize = sizeof(short);
+            *kind = FetchKind::Int16;
+            return fetchShort;
+
+        case SQL_C_SLONG:
+        case SQL_C_ULONG:
+        case SQL_C_LONG:
+            *elementSize = sizeof(int);
+            *kind = FetchKind::Int32;
+            return fetchInt;
+
+        case SQL_C_FLOAT:
+            *elementSize = sizeof(float);
+            *kind = FetchKind::Float;
+            return fetchFloat;
+
+        case SQL_C_DOUBLE:
+            *elementSize = sizeof(double);
+            *kind = FetchKind::Double;
+            return fetchDouble;
+
+        case SQL_C_STINYINT:
+        case SQL_C_UTINYINT:
+        case SQL_C_TINYINT:
+            *elementSize = sizeof(char);
+            *kind = FetchKind::Int8;
+            return fetchTinyInt;
+
+        case SQL_C_SBIGINT:
+        case SQL_C_UBIGINT:
+            *elementSize = sizeof(int64_t);
+            *kind = FetchKind::Int64;
+            return fetchBigInt;
+
+        case SQL_TYPE_DATE:
+        case SQL_C_DATE:
+            *elementSize = sizeof(tagDATE_STRUCT);
+            return fetchDate;
+
+        case SQL_TYPE_TIMESTAMP:
+        case SQL_C_TIMESTAMP:
+            *elementSize = sizeof(tagTIMESTAMP_STRUCT);
+            return fetchTimestamp;
+
+        case SQL_C_TIME:
+        case SQL_TYPE_TIME:
+            *elementSize = sizeof(tagTIME_STRUCT);
+            return fetchTime;
+
+        case SQL_C_NUMERIC:
+            *elementSize = sizeof(SQL_NUMERIC_STRUCT);
+            return fetchNumeric;
+
+        case SQL_C_NUODB_FILE:
+            *elementSize = bufferLength;
+            return fetchFile;
+
+        default:
+            *elementSize = 0;
+            return fetchUnsupported;
+    }
+}
+
+template <typename T, typename S>
+static void storeValues(char* data, const std::vector<S>& values, SQLULEN rows)
+{
+    T* out = (T*)data;
+    for (SQLULEN n = 0; n < rows; ++n) {
+        out[n] = (T)values[n];
+    }
+}
+
+static void storeIndicators(SQLLEN* indicators, const std::vector<char>& nulls, SQLLEN size, SQLULEN rows)
+{
+    for (SQLULEN n = 0; n < rows; ++n) {
+        indicators[n] = nulls[n] ? SQL_NULL_DATA : size;
+    }
+}
+
+// Diagnostics posted by the conversion of one range of rows, kept until
+// all ranges are done.
+class TaskDiagnostics final : public OdbcObject
+{
+public:
+    OdbcObjectType getType() final { return odbcTypeStatement; }
+
+    void moveTo(OdbcObject* owner)
+    {
+        while (OdbcError* error = errors) {
+            errors = error->next;
+            owner->postError(error);
+        }
+    }
+};
+
+// The return of a row from those of its columns: an error in any column
+// makes it an error, and otherwise a warning makes it a warning.
+static int combine(int rowRet, int ret)
+{
+    if (rowRet == SQL_ERROR || ret == SQL_ERROR) {
+        return SQL_ERROR;
+    }
+    return std::max(rowRet, ret);
+}
+
+static void setRowStatus(SQLUSMALLINT* rowStatus, SQLULEN row, int rowRet)
+{
+    if (rowStatus) {
+        rowStatus[row] = rowRet == SQL_ERROR ? SQL_ROW_ERROR
+                       : rowRet == SQL_SUCCESS_WITH_INFO ? SQL_ROW_SUCCESS_WITH_INFO
+                       : SQL_ROW_SUCCESS;
+    }
+}
+
+// Convert one column of row 'row' of the rowset, with whatever is posted
+// placed at that row and column.
+static int convertCell(OdbcObject* owner, ResultSet* results, const FetchColumn& column, SQLULEN row)
+{
+    char*   data = column.data + row * column.dataStride;
+    SQLLEN* indicator = column.indicator ? (SQLLEN*)(column.indicator + row * column.indicatorStride) : nullptr;
+    int     ret;
+
+    owner->setDiagPosition((SQLLEN)row + 1, column.column);
+    try {
+        ret = column.convert(owner, results, column, data, indicator);
+    } catch (SQLException& e) {
+        if (e.getSqlcode() == TRUNCATION_ERROR) {
+            owner->postError("01004", e);
+            ret = SQL_SUCCESS_WITH_INFO;
+        } else {
+            owner->postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(e.getSqlcode()), e);
+            ret = SQL_ERROR;
+        }
+    }
+    owner->clearDiagPosition();
+
+    return ret;
+}
+
+// The return of a rowset: an error only if every row failed, or none were
+// read because the cursor did.
+static int rowsetReturn(int ret, SQLULEN rows, SQLULEN errorRows)
+{
+    if (ret == SQL_ERROR || (rows > 0 && errorRows == rows)) {
+        return SQL_ERROR;
+    }
+    return errorRows > 0 ? SQL_SUCCESS_WITH_INFO : ret;
+}
+
+} // namespace FETCH_PLAN
+
+void FetchPlan::compile(Bindings& bindings, ResultSet* results, SQLULEN rowSize, SQLULEN maxLength,
+                        TimeZoneCache* timeZone, OdbcDesc* rowDescriptor)
+{
+    columns.clear();
+    valid = false;
+
+    ResultSetMetaData* metaData = nullptr;
+
+    for (int n = 1; n <= bindings.getCount(); ++n) {
+        Binding* binding = bindings.getBinding(n);
+        if (!binding->pointer || binding->type == SQL_PARAM_INPUT) {
+            continue;
+        }
+
+        FetchColumn column;
+        column.column = n;
+        column.cType = binding->cType;
+        column.bufferLength = binding->bufferLength;
+        column.maxLength = maxLength;
+        column.data = (char*)binding->pointer;
+        column.indicator = (char*)binding->indicatorPointer;
+
+        if (column.cType == SQL_C_DEFAULT) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            column.cType = OdbcStatement::convertFromSQL_C_DEFAULT((int)OdbcTypeMapper::mapType(metaData->getColumnType(n)));
+        }
+
+        SQLLEN elementSize;
+        column.convert = FETCH_PLAN::getConverter(column.cType, column.bufferLength, &elementSize, &column.kind);
+        column.timeZone = timeZone;
+
+        if (column.convert == FETCH_PLAN::fetchTimestamp) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            if (DateTime::isWithoutTimeZone(metaData->getColumnTypeName(n))) {
+                column.convert = FETCH_PLAN::fetchTimestampNoTZ;
+            }
+        }
+
+        if (column.convert == FETCH_PLAN::fetchChar || column.convert == FETCH_PLAN::fetchWChar) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            column.text = TextFormat::getTextKind(metaData, n);
+            if (column.text != TextFormat::TextKind::None) {
+                column.convert = column.convert == FETCH_PLAN::fetchChar ? FETCH_PLAN::fetchFormattedChar : FETCH_PLAN::fetchFormattedWChar;
+            }
+        }
+
+        if (column.convert == FETCH_PLAN::fetchChar) {
+            int type = metaData->getColumnType(n);
+            if (OdbcTypeMapper::isInlineBinary(type) || type == (int)NUOSQL_BLOB) {
+                column.convert = FETCH_PLAN::fetchHex;
+                column.sqlType = type;
+            }
+        }
+
+        if (column.convert == FETCH_PLAN::fetchBinary) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            if (OdbcTypeMapper::isInlineBinary(metaData->getColumnType(n))) {
+                column.convert = FETCH_PLAN::fetchBytes;
+            }
+        }
+
+        if (column.convert == FETCH_PLAN::fetchFile) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            column.sqlType = metaData->getColumnType(n);
+        }
+
+        // the ARD's precision and scale if the application set them,
+        // otherwise the column's own
+        if (column.convert == FETCH_PLAN::fetchNumeric && !rowDescriptor->getPrecisionAndScale(n, &column.precision, &column.scale)) {
+            if (!metaData) {
+                metaData = results->getMetaData();
+            }
+            column.precision = metaData->getPrecision(n);
+            column.scale = metaData->getScale(n);
+        }
+
+        if (rowSize == SQL_BIND_BY_COLUMN) {
+            column.dataStride = elementSize;
+            column.indicatorStride = sizeof(SQLLEN);
+        } else {
+            column.dataStride = rowSize;
+            column.indicatorStride = rowSize;
+        }
+
+        columns.push_back(column);
+    }
+
+    staged.clear();
+    staged.resize(columns.size());
+
+    layout.reset();
+    layoutColumns.clear();
+    views.clear();
+    if (!columns.empty()) {
+        if (!metaData) {
+            metaData = results->getMetaData();
+        }
+        StagedKind kind;
+        bool       stageable = true;
+        for (const FetchColumn& column : columns) {
+            stageable = stageable && StagedResultSet::getKind(metaData, column.column, &kind);
+            layoutColumns.push_back(column.column);
+        }
+        if (stageable) {
+            layout.reset(new StagedResultSet(metaData, timeZone));
+        }
+    }
+
+    valid = true;
+}
+
+int FetchPlan::fetchRow(OdbcObject* owner, ResultSet* results, SQLULEN row) const
+{
+    int ret = SQL_SUCCESS;
+    for (const FetchColumn& column : columns) {
+        ret = FETCH_PLAN::combine(ret, FETCH_PLAN::convertCell(owner, results, column, row));
+    }
+
+    return ret;
+}
+
+int FetchPlan::stageRow(OdbcObject* owner, ResultSet* results, SQLULEN row)
+{
+    int ret = SQL_SUCCESS;
+    for (size_t n = 0; n < columns.size(); ++n) {
+        const FetchColumn&  column = columns[n];
+        StagedColumn&       stage = staged[n];
+
+        if (column.kind == FetchKind::Converter) {
+            ret = FETCH_PLAN::combine(ret, FETCH_PLAN::convertCell(owner, results, column, row));
+            continue;
+        }
+
+        owner->setDiagPosition((SQLLEN)row + 1, column.column);
+        try {
+            switch (column.kind) {
+                case FetchKind::Converter:
+                    break;
+
+                case FetchKind::Int8:
+                    stage.integers[row] = results->getByte(column.column);
+                    break;
+
+                case FetchKind::Int16:
+                    stage.integers[row] = results->getShort(column.column);
+                    break;
+
+                case FetchKind::Int32:
+                    stage.integers[row] = results->getInt(column.column);
+                    break;
+
+                case FetchKind::Int64:
+                    stage.integers[row] = results->getLong(column.column);
+                    break;
+
+                case FetchKind::Float:
+                    stage.reals[row] = results->getFloat(column.column);
+                    break;
+
+                case FetchKind::Double:
+                    stage.reals[row] = results->getDouble(column.column);
+                    break;
+            }
+            stage.nulls[row] = results->wasNull();
+        } catch (SQLException& e) {
+            if (e.getSqlcode() == TRUNCATION_ERROR) {
+                owner->postError("01004", e);
+                ret = FETCH_PLAN::combine(ret, SQL_SUCCESS_WITH_INFO);
+            } else {
+                owner->postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(e.getSqlcode()), e);
+                ret = SQL_ERROR;
+            }
+        }
+        owner->clearDiagPosition();
+    }
+
+    return ret;
+}
+
+void FetchPlan::storeBlock(SQLULEN rows)
+{
+    for (size_t n = 0; n < columns.size(); ++n) {
+        const FetchColumn&  column = columns[n];
+        const StagedColumn& stage = staged[n];
+
+        switch (column.kind) {
+            case FetchKind::Converter:
+                continue;
+
+            case FetchKind::Int8:
+                FETCH_PLAN::storeValues<char>(column.data, stage.integers, rows);
+                break;
+
+            case FetchKind::Int16:
+                FETCH_PLAN::storeValues<short>(column.data, stage.integers, rows);
+                break;
+
+            case FetchKind::Int32:
+                FETCH_PLAN::storeValues<int>(column.data, stage.integers, rows);
+                break;
+
+            case FetchKind::Int64:
+                FETCH_PLAN::storeValues<int64_t>(column.data, stage.integers, rows);
+                break;
+
+            case FetchKind::Float:
+                FETCH_PLAN::storeValues<float>(column.data, stage.reals, rows);
+                break;
+
+            case FetchKind::Double:
+                FETCH_PLAN::storeValues<double>(column.data, stage.reals, rows);
+                break;
+        }
+
+        if (column.indicator) {
+            FETCH_PLAN::storeIndicators((SQLLEN*)column.indicator, stage.nulls, column.dataStride, rows);
+        }
+    }
+}
+
+int FetchPlan::fetchBlock(OdbcObject* owner, ResultSet* results, SQLULEN maxRows, SQLULEN* rowsFetched,
+                          SQLUSMALLINT* rowStatus, StagedRowset* rowset)
+{
+    for (size_t n = 0; n < columns.size(); ++n) {
+        StagedColumn& stage = staged[n];
+
+        switch (columns[n].kind) {
+            case FetchKind::Converter:
+                continue;
+
+            case FetchKind::Float:
+            case FetchKind::Double:
+                stage.reals.resize(maxRows);
+                break;
+
+            default:
+                stage.integers.resize(maxRows);
+                break;
+        }
+        stage.nulls.assign(maxRows, 0);
+    }
+
+    SQLULEN rows = 0;
+    SQLULEN errorRows = 0;
+    int     ret = SQL_SUCCESS;
+
+    // a row that fails to convert is marked and the rest go on
+    try {
+        for (; rows < maxRows && results->next(); ++rows) {
+            int rowRet = stageRow(owner, results, rows);
+            FETCH_PLAN::setRowStatus(rowStatus, rows, rowRet);
+            if (rowRet == SQL_ERROR) {
+                ++errorRows;
+            }
+            if (rowset) {
+                rowset->stage(results);
+            }
+        }
+    } catch (SQLException& exception) {
+        owner->postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+        ret = SQL_ERROR;
+    }
+
+    storeBlock(rows);
+    *rowsFetched = rows;
+
+    return FETCH_PLAN::rowsetReturn(ret, rows, errorRows);
+}
+
+int FetchPlan::fetchParallel(OdbcObject* owner, ResultSet* results, SQLULEN maxRows, SQLULEN* rowsFetched,
+                             SQLUSMALLINT* rowStatus, WorkerPool* workers, StagedRowset* rowset)
+{
+    if (stagedRows.size() < maxRows) {
+        stagedRows.resize(maxRows);
+    }
+
+    // only reading the rows has to follow the cursor
+    SQLULEN rows = 0;
+    int     ret = SQL_SUCCESS;
+
+    try {
+        for (; rows < maxRows && results->next(); ++rows) {
+            layout->stageRow(results, stagedRows[rows], &layoutColumns);
+            if (rowset) {
+                rowset->stage(results);
+            }
+        }
+    } catch (SQLException& exception) {
+        owner->postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+        ret = SQL_ERROR;
+    }
+
+    int tasks = (int)std::min<SQLULEN>(workers->getThreadCount() + 1, (rows + MIN_ROWS_PER_TASK - 1) / MIN_ROWS_PER_TASK);
+    while ((int)views.size() < tasks) {
+        views.emplace_back(new StagedResultSet(results->getMetaData(), columns[0].timeZone));
+    }
+
+    std::vector<FETCH_PLAN::TaskDiagnostics> diagnostics(tasks);
+    std::vector<SQLULEN>                     errorRows(tasks, 0);
+
+    workers->run(tasks, [&](int task) {
+        SQLULEN          first = rows * task / tasks;
+        SQLULEN          last = rows * (task + 1) / tasks;
+        StagedResultSet* view = views[task].get();
+
+        // the columns' day memos aren't shared between threads
+        std::vector<FetchColumn> taskColumns = columns;
+
+        for (SQLULEN row = first; row < last; ++row) {
+            view->setRow(&stagedRows[row]);
+            int rowRet = SQL_SUCCESS;
+            for (const FetchColumn& column : taskColumns) {
+                rowRet = FETCH_PLAN::combine(rowRet, FETCH_PLAN::convertCell(&diagnostics[task], view, column, row));
+            }
+            FETCH_PLAN::setRowStatus(rowStatus, row, rowRet);
+            if (rowRet == SQL_ERROR) {
+                ++errorRows[task];
+            }
+        }
+    });
+
+    // the diagnostics of each range in turn, which keeps them in row order
+    SQLULEN failed = 0;
+    for (int task = 0; task < tasks; ++task) {
+        diagnostics[task].moveTo(owner);
+        failed += errorRows[task];
+    }
+
+    for (StagedRow& row : stagedRows) {
+        layout->releaseRow(row);
+    }
+
+    *rowsFetched = rows;
+    return FETCH_PLAN::rowsetReturn(ret, rows, failed);
+}
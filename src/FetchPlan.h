@@ -0,0 +1,133 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "OdbcBase.h"
+#include "StagedResultSet.h"
+#include "TextFormat.h"
+
+namespace NuoDB {
+class ResultSet;
+}
+
+class Bindings;
+class OdbcDesc;
+class OdbcObject;
+class TimeZoneCache;
+class WorkerPool;
+struct FetchColumn;
+
+// Convert the value of one column of the current row into the application
+// buffer.  Diagnostics are posted on the owner; returns an ODBC return code.
+typedef int (*FetchConverter)(OdbcObject* owner, NuoDB::ResultSet* results,
+                              const FetchColumn& column, char* data, SQLLEN* indicator);
+
+// How a column is moved into the application buffer.  Fixed width numeric
+// columns can be staged and stored a whole block of rows at a time; the
+// rest go through their converter one cell at a time.
+enum class FetchKind : char
+{
+    Converter,
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    Float,
+    Double,
+};
+
+// A bound column with everything SQLFetch needs resolved up front: the
+// converter for its C type and the address of its value and indicator in
+// row 0 of the rowset, plus the distance to the next row.
+struct FetchColumn
+{
+    FetchConverter convert = nullptr;
+    TimeZoneCache* timeZone = nullptr;
+    char*   data = nullptr;
+    char*   indicator = nullptr;
+    SQLLEN  dataStride = 0;
+    SQLLEN  indicatorStride = 0;
+    SQLLEN  bufferLength = 0;
+    SQLULEN maxLength = 0;  // SQL_ATTR_MAX_LENGTH, 0 if there's no cap
+    int     column = 0;
+    int     cType = 0;
+    int     precision = 0;  // SQL_C_NUMERIC only
+    int     scale = 0;
+    int     sqlType = 0;    // SQL_C_NUODB_FILE, and binary columns read as SQL_C_CHAR
+    TextFormat::TextKind text = TextFormat::TextKind::None;  // typed columns read as text
+    FetchKind kind = FetchKind::Converter;
+    mutable DateTime::DayMemo memo;  // date and time columns; a copy per thread
+};
+
+// Natural-kind staging of one fixed width column for a block of rows.
+struct StagedColumn
+{
+    std::vector<int64_t> integers;
+    std::vector<double>  reals;
+    std::vector<char>    nulls;
+};
+
+// The bound columns of a statement compiled against the current result set.
+// The plan has to be invalidated whenever a binding, the row bind type, or
+// the result set changes; it's then recompiled on the next SQLFetch.
+class FetchPlan final
+{
+public:
+    bool isValid() const  { return valid; }
+    void invalidate()     { valid = false; }
+
+    const std::vector<FetchColumn>& getColumns() const { return columns; }
+
+    void compile(Bindings& bindings, NuoDB::ResultSet* results, SQLULEN rowSize, SQLULEN maxLength,
+                 TimeZoneCache* timeZone, OdbcDesc* rowDescriptor);
+
+    // Fill in row 'row' of the rowset from the current row of results.  A
+    // column that fails doesn't stop the rest being converted; the return
+    // is SQL_ERROR if any failed.  Diagnostics are placed at the row and
+    // column they arose on.
+    int  fetchRow(OdbcObject* owner, NuoDB::ResultSet* results, SQLULEN row) const;
+
+    // Fill in up to maxRows rows of a column-wise bound rowset, advancing
+    // results for each one.  Fixed width columns are staged while the rows
+    // are read and then stored column by column.  Fewer than maxRows rows
+    // in *rowsFetched means the result set is exhausted.  Each row is also
+    // staged into rowset, if there is one.  A row that fails to convert is
+    // marked SQL_ROW_ERROR in rowStatus, if there is one, and the rest of
+    // the rowset is still converted; SQL_ERROR is returned only if the
+    // cursor fails or every row does.
+    int  fetchBlock(OdbcObject* owner, NuoDB::ResultSet* results, SQLULEN maxRows, SQLULEN* rowsFetched,
+                    SQLUSMALLINT* rowStatus, StagedRowset* rowset = nullptr);
+
+    // Whether every bound column can be staged, which fetchParallel needs.
+    bool canStage() const { return layout != nullptr; }
+
+    // Like fetchBlock, for either binding: the rows are read and staged in
+    // turn, then converted into the rowset by the workers, a range of rows
+    // each.  Diagnostics are posted in row order once all are done.
+    int  fetchParallel(OdbcObject* owner, NuoDB::ResultSet* results, SQLULEN maxRows, SQLULEN* rowsFetched,
+                       SQLUSMALLINT* rowStatus, WorkerPool* workers, StagedRowset* rowset = nullptr);
+
+private:
+    int  stageRow(OdbcObject* owner, NuoDB::ResultSet* results, SQLULEN row);
+    void storeBlock(SQLULEN rows);
+
+    std::vector<FetchColumn>  columns;
+    std::vector<StagedColumn> staged;
+    bool valid = false;
+
+    // fetchParallel: the bound columns, the rows read, and a view on them
+    // for each task
+    std::unique_ptr<StagedResultSet>              layout;
+    std::vector<int>                              layoutColumns;
+    std::vector<StagedRow>                        stagedRows;
+    std::vector<std::unique_ptr<StagedResultSet>> views;
+};
@@ -0,0 +1,333 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <string.h>
+
+#include "HexCodec.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+# define HEX_CODEC_SSE2
+# if defined(_MSC_VER) || defined(__GNUC__)
+#  define HEX_CODEC_AVX2
+# endif
+#elif defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define HEX_CODEC_SSE2
+#endif
+
+#ifdef HEX_CODEC_SSE2
+# include <immintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+#if defined(HEX_CODEC_AVX2) && defined(__GNUC__)
+# define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+# define TARGET_AVX2
+#endif
+
+namespace HEX_CODEC {
+
+// Encode the whole blocks at the start of in (up to length bytes) into out.
+// Returns the number of bytes handled.
+typedef size_t (*EncodeKernel)(const uint8_t* in, size_t length, char* out);
+
+// Decode the whole blocks of hex digits at the start of in (up to length
+// bytes' worth) into out, stopping at a block with something else in it.
+// Returns the number of bytes decoded.
+typedef size_t (*DecodeKernel)(const char* in, size_t length, uint8_t* out);
+
+struct Kernels
+{
+    EncodeKernel encode;
+    DecodeKernel decode;
+    const char*  name;
+};
+
+static const char digits[] = "0123456789ABCDEF";
+
+// The value of each character as a hex digit, or -1.
+struct DigitValues
+{
+    DigitValues()
+    {
+        memset(values, -1, sizeof(values));
+        for (int n = 0; n < 10; ++n) {
+            values['0' + n] = (int8_t)n;
+        }
+        for (int n = 0; n < 6; ++n) {
+            values['A' + n] = values['a' + n] = (int8_t)(10 + n);
+        }
+    }
+
+    int8_t values[256];
+};
+
+static const DigitValues digitValues;
+
+// Without SSE2 the byte at a time loops do all the work.
+static size_t encodeScalar(const uint8_t*, size_t, char*)
+{
+    return 0;
+}
+
+static size_t decodeScalar(const char*, size_t, uint8_t*)
+{
+    return 0;
+}
+
+#ifdef HEX_CODEC_SSE2
+
+// The hex digit of each nibble, 0 to 15.
+static inline __m128i toDigitsSse2(__m128i nibbles)
+{
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+// Inline, so that what's left after the AVX2 loops is done in VEX encoded
+// instructions too: switching back to the legacy encoding costs more than a
+// short value takes to encode.
+static inline size_t encodeSse2(const uint8_t* in, size_t length, char* out)
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t        n = 0;
+
+    for (; n + 16 <= length; n += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(in + n));
+        __m128i high = toDigitsSse2(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        __m128i low = toDigitsSse2(_mm_and_si128(bytes, mask));
+        _mm_storeu_si128((__m128i*)(out + 2 * n), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i*)(out + 2 * n + 16), _mm_unpackhi_epi8(high, low));
+    }
+
+    return n;
+}
+
+// The value of each of 16 hex digits, or false if one isn't a digit.
+// Bytes past 0x7F compare as negative, so fall outside both ranges.
+static inline bool toNibblesSse2(__m128i chars, __m128i* nibbles)
+{
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+
+    if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF) {
+        return false;
+    }
+
+    *nibbles = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                            _mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+    return true;
+}
+
+// Each pair of nibbles as the 16 bit value of its byte.
+static inline __m128i toBytesSse2(__m128i nibbles)
+{
+    __m128i high = _mm_and_si128(nibbles, _mm_set1_epi16(0x00FF));
+    return _mm_or_si128(_mm_slli_epi16(high, 4), _mm_srli_epi16(nibbles, 8));
+}
+
+static inline size_t decodeSse2(const char* in, size_t length, uint8_t* out)
+{
+    size_t n = 0;
+
+    for (; n + 16 <= length; n += 16) {
+        __m128i first, second;
+        if (!toNibblesSse2(_mm_loadu_si128((const __m128i*)(in + 2 * n)), &first) ||
+            !toNibblesSse2(_mm_loadu_si128((const __m128i*)(in + 2 * n + 16)), &second)) {
+            break;
+        }
+        _mm_storeu_si128((__m128i*)(out + n), _mm_packus_epi16(toBytesSse2(first), toBytesSse2(second)));
+    }
+
+    return n;
+}
+
+#endif
+
+#ifdef HEX_CODEC_AVX2
+
+TARGET_AVX2 static size_t encodeAvx2(const uint8_t* in, size_t length, char* out)
+{
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                                                    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t        n = 0;
+
+    for (; n + 32 <= length; n += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(in + n));
+        __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(bytes, mask));
+
+        // the unpacks work within each 128 bit lane: bytes 0-7 and 16-23,
+        // then 8-15 and 24-31
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256((__m256i*)(out + 2 * n), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256((__m256i*)(out + 2 * n + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    return n + encodeSse2(in + n, length - n, out + 2 * n);
+}
+
+TARGET_AVX2 static inline bool toNibblesAvx2(__m256i chars, __m256i* nibbles)
+{
+    __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1) {
+        return false;
+    }
+
+    *nibbles = _mm256_or_si256(_mm256_and_si256(digit, _mm256_sub_epi8(chars, _mm256_set1_epi8('0'))),
+                               _mm256_and_si256(letter, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+    return true;
+}
+
+TARGET_AVX2 static inline __m256i toBytesAvx2(__m256i nibbles)
+{
+    __m256i high = _mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF));
+    return _mm256_or_si256(_mm256_slli_epi16(high, 4), _mm256_srli_epi16(nibbles, 8));
+}
+
+TARGET_AVX2 static size_t decodeAvx2(const char* in, size_t length, uint8_t* out)
+{
+    size_t n = 0;
+
+    for (; n + 32 <= length; n += 32) {
+        __m256i first, second;
+        if (!toNibblesAvx2(_mm256_loadu_si256((const __m256i*)(in + 2 * n)), &first) ||
+            !toNibblesAvx2(_mm256_loadu_si256((const __m256i*)(in + 2 * n + 32)), &second)) {
+            break;
+        }
+        // the pack works within each lane too: put the quarters in order
+        __m256i bytes = _mm256_packus_epi16(toBytesAvx2(first), toBytesAvx2(second));
+        _mm256_storeu_si256((__m256i*)(out + n), _mm256_permute4x64_epi64(bytes, 0xD8));
+    }
+
+    return n + decodeSse2(in + 2 * n, length - n, out + n);
+}
+
+static bool hasAvx2()
+{
+# ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    // the OS has to save the AVX registers as well
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+# else
+    return __builtin_cpu_supports("avx2");
+# endif
+}
+
+#endif
+
+static Kernels selectKernels()
+{
+#ifdef HEX_CODEC_AVX2
+    if (hasAvx2()) {
+        return { encodeAvx2, decodeAvx2, "avx2" };
+    }
+#endif
+#ifdef HEX_CODEC_SSE2
+    return { encodeSse2, decodeSse2, "sse2" };
+#else
+    return { encodeScalar, decodeScalar, "scalar" };
+#endif
+}
+
+static Kernels kernels = selectKernels();
+
+} // namespace HEX_CODEC
+
+namespace HexCodec {
+
+void encode(const uint8_t* in, size_t length, char* out)
+{
+    size_t n = HEX_CODEC::kernels.encode(in, length, out);
+
+    for (out += 2 * n; n < length; ++n) {
+        *out++ = HEX_CODEC::digits[in[n] >> 4];
+        *out++ = HEX_CODEC::digits[in[n] & 0xf];
+    }
+}
+
+void encodeDigits(const uint8_t* in, size_t first, size_t count, char* out)
+{
+    if (count == 0) {
+        return;
+    }
+
+    size_t byte = first / 2;
+    if (first % 2) {
+        *out++ = HEX_CODEC::digits[in[byte++] & 0xf];
+        --count;
+    }
+
+    size_t whole = count / 2;
+    encode(in + byte, whole, out);
+    if (count % 2) {
+        out[2 * whole] = HEX_CODEC::digits[in[byte + whole] >> 4];
+    }
+}
+
+bool decode(const char* in, size_t length, uint8_t* out)
+{
+    if (length % 2) {
+        return false;
+    }
+
+    size_t bytes = length / 2;
+    size_t n = HEX_CODEC::kernels.decode(in, bytes, out);
+
+    for (; n < bytes; ++n) {
+        int high = HEX_CODEC::digitValues.values[(uint8_t)in[2 * n]];
+        int low = HEX_CODEC::digitValues.values[(uint8_t)in[2 * n + 1]];
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out[n] = (uint8_t)(high << 4 | low);
+    }
+
+    return true;
+}
+
+const char* getKernelName()
+{
+    return HEX_CODEC::kernels.name;
+}
+
+bool useKernel(const char* name)
+{
+    if (!strcmp(name, "scalar")) {
+        HEX_CODEC::kernels = { HEX_CODEC::encodeScalar, HEX_CODEC::decodeScalar, "scalar" };
+        return true;
+    }
+#ifdef HEX_CODEC_SSE2
+    if (!strcmp(name, "sse2")) {
+        HEX_CODEC::kernels = { HEX_CODEC::encodeSse2, HEX_CODEC::decodeSse2, "sse2" };
+        return true;
+    }
+#endif
+#ifdef HEX_CODEC_AVX2
+    if (!strcmp(name, "avx2") && HEX_CODEC::hasAvx2()) {
+        HEX_CODEC::kernels = { HEX_CODEC::encodeAvx2, HEX_CODEC::decodeAvx2, "avx2" };
+        return true;
+    }
+#endif
+    return false;
+}
+
+}
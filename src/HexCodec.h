@@ -0,0 +1,41 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary values as hex text: BINARY, VARBINARY and BLOB columns read as
+// SQL_C_CHAR, and binary parameters sent as SQL_C_CHAR.  Whole blocks of
+// bytes are encoded and decoded with SSE2 or AVX2 when the CPU has them;
+// what's left over goes a byte at a time.
+namespace HexCodec {
+
+// Two upper case hex digits for each of length bytes at in.
+void encode(const uint8_t* in, size_t length, char* out);
+
+// count digits of the hex text of the bytes at in, starting with digit
+// first, which may be the second of a byte's pair: for a value read a piece
+// at a time, whose pieces needn't end on a byte.  in is the start of the
+// whole value.
+void encodeDigits(const uint8_t* in, size_t first, size_t count, char* out);
+
+// Decode length hex digits at in, of either case, into length / 2 bytes at
+// out.  Returns false if length is odd or something isn't a hex digit, in
+// which case out is left part written.
+bool decode(const char* in, size_t length, uint8_t* out);
+
+// The name of the kernel picked for this CPU, for tracing.
+const char* getKernelName();
+
+// Use the kernel named, "scalar", "sse2" or "avx2", rather than the one
+// picked, so that tests and benchmarks can compare them; false if this
+// CPU can't run it.  Only while nothing is being converted.
+bool useKernel(const char* name);
+
+}
@@ -5,13 +5,13 @@
  * See the LICENSE file provided with this software.
  */
 
-NITEM(SQL_GETDATA_EXTENSIONS, 0)
+NITEM(SQL_GETDATA_EXTENSIONS, (SQL_GD_ANY_COLUMN | SQL_GD_ANY_ORDER | SQL_GD_BLOCK | SQL_GD_BOUND))
 UITEM(SQL_ASYNC_MODE, 0)
 UITEM(SQL_INFO_SCHEMA_VIEWS, 0)
 UITEM(SQL_BATCH_ROW_COUNT, 0)
-NITEM(SQL_KEYSET_CURSOR_ATTRIBUTES1, 0)
+NITEM(SQL_KEYSET_CURSOR_ATTRIBUTES1, (SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE | SQL_CA1_LOCK_NO_CHANGE | SQL_CA1_POS_POSITION))
 UITEM(SQL_BATCH_SUPPORT, 0)
-NITEM(SQL_KEYSET_CURSOR_ATTRIBUTES2, 0)
+NITEM(SQL_KEYSET_CURSOR_ATTRIBUTES2, (SQL_CA2_READ_ONLY_CONCURRENCY | SQL_CA2_SENSITIVITY_DELETIONS | SQL_CA2_SENSITIVITY_UPDATES | SQL_CA2_MAX_ROWS_SELECT))
 CITEM(SQL_DATA_SOURCE_NAME, "")
 UITEM(SQL_MAX_ASYNC_CONCURRENT_STATEMENTS, 0)
 UITEM(SQL_DRIVER_HDBC, 0)
@@ -38,10 +38,10 @@ NITEM(SQL_DYNAMIC_CURSOR_ATTRIBUTES1, 0)
 CITEM(SQL_SEARCH_PATTERN_ESCAPE, "")
 NITEM(SQL_DYNAMIC_CURSOR_ATTRIBUTES2, 0)
 CITEM(SQL_SERVER_NAME, "")
-NITEM(SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1, 0)
-NITEM(SQL_STATIC_CURSOR_ATTRIBUTES1, 0)
+NITEM(SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1, (SQL_CA1_NEXT | SQL_CA1_POS_POSITION))
+NITEM(SQL_STATIC_CURSOR_ATTRIBUTES1, (SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE | SQL_CA1_LOCK_NO_CHANGE | SQL_CA1_POS_POSITION))
 NITEM(SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES2, 0)
-NITEM(SQL_STATIC_CURSOR_ATTRIBUTES2, 0)
+NITEM(SQL_STATIC_CURSOR_ATTRIBUTES2, (SQL_CA2_READ_ONLY_CONCURRENCY | SQL_CA2_MAX_ROWS_SELECT))
 NITEM(SQL_FILE_USAGE, 0)
 
 CITEM(SQL_DATABASE_NAME, "")
@@ -62,7 +62,7 @@ NITEM(SQL_CONCAT_NULL_BEHAVIOR, 0)
 
 CITEM(SQL_SCHEMA_TERM, "")
 SITEM(SQL_CURSOR_COMMIT_BEHAVIOR, 0)
-UITEM(SQL_SCROLL_OPTIONS, 0)
+UITEM(SQL_SCROLL_OPTIONS, (SQL_SO_FORWARD_ONLY | SQL_SO_KEYSET_DRIVEN | SQL_SO_STATIC))
 SITEM(SQL_CURSOR_ROLLBACK_BEHAVIOR, 0)
 CITEM(SQL_TABLE_TERM, "")
 UITEM(SQL_CURSOR_SENSITIVITY, 0)
@@ -177,8 +177,8 @@ UITEM(SQL_ACTIVE_ENVIRONMENTS, 0)
 UITEM(SQL_DM_VER, 0)
 UITEM(SQL_XOPEN_CLI_YEAR, 0)
 
-UITEM(SQL_FETCH_DIRECTION, 0)
-NITEM(SQL_POS_OPERATIONS, 0)
+UITEM(SQL_FETCH_DIRECTION, (SQL_FD_FETCH_NEXT | SQL_FD_FETCH_FIRST | SQL_FD_FETCH_LAST | SQL_FD_FETCH_PRIOR | SQL_FD_FETCH_ABSOLUTE | SQL_FD_FETCH_RELATIVE))
+NITEM(SQL_POS_OPERATIONS, SQL_POS_POSITION)
 NITEM(SQL_LOCK_TYPES, 0)
 NITEM(SQL_POSITIONED_STATEMENTS, 0)
 SITEM(SQL_ODBC_API_CONFORMANCE, SQL_OAC_LEVEL2)
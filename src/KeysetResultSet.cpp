@@ -0,0 +1,306 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "KeysetResultSet.h"
+
+#include "OdbcBase.h"
+#include "OdbcConnection.h"
+
+#include "NuoRemote/DatabaseMetaData.h"
+#include "NuoRemote/PreparedStatement.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "SQLException.h"
+
+using namespace NuoDB;
+
+namespace KEYSET_RESULT_SET {
+
+static std::string quote(const char* name)
+{
+    std::string quoted = "\"";
+    for (const char* p = name; *p; ++p) {
+        if (*p == '"') {
+            quoted += '"';
+        }
+        quoted += *p;
+    }
+    return quoted + "\"";
+}
+
+static void appendKey(std::string& key, const char* value, size_t length)
+{
+    key += std::to_string(length);
+    key += ':';
+    key.append(value, length);
+}
+
+} // namespace KEYSET_RESULT_SET
+
+KeysetResultSet* KeysetResultSet::open(OdbcConnection* connection, ResultSet* base, size_t memoryBudget,
+                                       size_t keysetSize, size_t maxRows)
+{
+    ResultSetMetaData* metaData = base->getMetaData();
+    int                count = metaData->getColumnCount();
+    if (count < 1) {
+        return nullptr;
+    }
+
+    std::string schema = metaData->getSchemaName(1);
+    std::string table = metaData->getTableName(1);
+    if (table.empty()) {
+        return nullptr;
+    }
+
+    // rows are read again by the names of their columns in the table
+    std::string select = "SELECT ";
+    for (int column = 1; column <= count; ++column) {
+        if (schema != metaData->getSchemaName(column) || table != metaData->getTableName(column)) {
+            return nullptr;
+        }
+        if (column > 1) {
+            select += ", ";
+        }
+        select += KEYSET_RESULT_SET::quote(metaData->getColumnName(column));
+    }
+    select += " FROM ";
+    if (!schema.empty()) {
+        select += KEYSET_RESULT_SET::quote(schema.c_str()) + ".";
+    }
+    select += KEYSET_RESULT_SET::quote(table.c_str()) + " WHERE ";
+
+    // the columns of the primary key, by their sequence in it
+    std::vector<std::pair<int, int>> primaryKey;
+    ResultSet*                       primaryKeys = nullptr;
+    try {
+        primaryKeys = connection->getMetaData()->getPrimaryKeys(nullptr, schema.empty() ? nullptr : schema.c_str(), table.c_str());
+        while (primaryKeys->next()) {
+            const char* name = primaryKeys->getString(4);
+            int         column = 1;
+            while (column <= count && strcmp(metaData->getColumnName(column), name) != 0) {
+                ++column;
+            }
+            if (column > count) {
+                primaryKey.clear();
+                break;
+            }
+            primaryKey.emplace_back(primaryKeys->getInt(5), column);
+        }
+        primaryKeys->close();
+    } catch (SQLException&) {
+        if (primaryKeys) {
+            primaryKeys->close();
+        }
+        return nullptr;
+    }
+
+    if (primaryKey.empty()) {
+        return nullptr;
+    }
+
+    std::sort(primaryKey.begin(), primaryKey.end());
+    std::vector<int> keyColumns;
+    for (auto& key : primaryKey) {
+        keyColumns.push_back(key.second);
+    }
+
+    return new KeysetResultSet(connection, base, keyColumns, std::move(select), memoryBudget, keysetSize, maxRows);
+}
+
+KeysetResultSet::KeysetResultSet(OdbcConnection* connect, ResultSet* b, const std::vector<int>& columns,
+                                 std::string&& query, size_t memoryBudget, size_t size, size_t rows)
+    : ScrollableResultSet(b->getMetaData(), connect->getTimeZoneCache(), true),
+      connection(connect),
+      base(b),
+      keyColumns(columns),
+      select(std::move(query)),
+      keys(std::vector<StagedKind>(columns.size(), StagedKind::String), memoryBudget, &columns, connect->getMemoryAccount()),
+      keysetSize(size),
+      maxRows(rows)
+{
+    base->addRef();
+}
+
+KeysetResultSet::~KeysetResultSet()
+{
+    releaseRows();
+    if (refetch) {
+        refetch->close();
+    }
+    base->release();
+}
+
+// Read keys from the base until there are at least count of them, or it
+// runs out: a keyset at a time, or the lot.
+void KeysetResultSet::fill(size_t count)
+{
+    if (keysetSize == 0 || count > SIZE_MAX - keysetSize) {
+        count = SIZE_MAX;
+    } else {
+        count = (count + keysetSize - 1) / keysetSize * keysetSize;
+    }
+
+    while (!exhausted && keys.getRowCount() < count) {
+        if (maxRows > 0 && keys.getRowCount() >= maxRows) {
+            // nothing more is wanted from the server's cursor
+            exhausted = true;
+            base->close();
+            break;
+        }
+        if (!base->next()) {
+            exhausted = true;
+            break;
+        }
+        keys.append(base);
+    }
+}
+
+void KeysetResultSet::seek(size_t row)
+{
+    if (row > 0) {
+        fill(row);
+    }
+
+    position = std::min(row, keys.getRowCount() + 1);
+    setRow(nullptr);
+}
+
+bool KeysetResultSet::absolute(size_t row)
+{
+    seek(row);
+    if (position == 0 || position > keys.getRowCount()) {
+        return false;
+    }
+
+    if (rowsStart == 0 || position < rowsStart || position >= rowsStart + rows.size()) {
+        load(position);
+    }
+
+    size_t n = position - rowsStart;
+    setRow(found[n] ? &rows[n] : nullptr);
+    return true;
+}
+
+bool KeysetResultSet::isDeleted(size_t row)
+{
+    return rowsStart > 0 && row >= rowsStart && row < rowsStart + rows.size() && !found[row - rowsStart];
+}
+
+size_t KeysetResultSet::getRowCount()
+{
+    fill(SIZE_MAX);
+    return keys.getRowCount();
+}
+
+// Nothing more is read from the base; the rows already read stay.
+void KeysetResultSet::close()
+{
+    if (!exhausted) {
+        exhausted = true;
+        base->close();
+    }
+}
+
+// Read the rows of a rowset from start again, with one query for all their
+// keys.  The statement is kept for as long as the rowset size stays the
+// same; a short last rowset repeats its last key.
+void KeysetResultSet::load(size_t start)
+{
+    releaseRows();
+    fill(start + rowsetSize - 1);
+    size_t count = std::min(rowsetSize, keys.getRowCount() - start + 1);
+
+    if (!refetch || refetchKeys != rowsetSize) {
+        std::string sql = select;
+        for (size_t n = 0; n < rowsetSize; ++n) {
+            if (keyColumns.size() == 1) {
+                sql += n == 0 ? KEYSET_RESULT_SET::quote(metaData->getColumnName(keyColumns[0])) + " IN (?" : ", ?";
+                continue;
+            }
+            sql += n == 0 ? "(" : " OR (";
+            for (size_t k = 0; k < keyColumns.size(); ++k) {
+                sql += (k == 0 ? "" : " AND ") + KEYSET_RESULT_SET::quote(metaData->getColumnName(keyColumns[k])) + " = ?";
+            }
+            sql += ")";
+        }
+        if (keyColumns.size() == 1) {
+            sql += ")";
+        }
+
+        if (refetch) {
+            refetch->close();
+            refetch = nullptr;
+        }
+        refetch = connection->prepareStatement(sql.c_str());
+        refetchKeys = rowsetSize;
+    }
+
+    // where the row of each key goes in the rowset
+    std::unordered_map<std::string, size_t> places;
+    StagedRow                               key;
+    int                                     parameter = 1;
+    for (size_t n = 0; n < rowsetSize; ++n) {
+        keys.read(start - 1 + std::min(n, count - 1), key);
+
+        std::string text;
+        for (StagedValue& value : key) {
+            refetch->setString(parameter++, value.string.c_str(), (int)value.string.size());
+            KEYSET_RESULT_SET::appendKey(text, value.string.data(), value.string.size());
+        }
+        if (n < count) {
+            places.emplace(std::move(text), n);
+        }
+    }
+
+    rows.resize(count);
+    found.assign(count, false);
+
+    refetched = refetch->executeQuery();
+    while (refetched->next()) {
+        auto place = places.find(readKey(refetched));
+        if (place != places.end() && !found[place->second]) {
+            stageRow(refetched, rows[place->second]);
+            found[place->second] = true;
+        }
+    }
+
+    rowsStart = start;
+}
+
+std::string KeysetResultSet::readKey(ResultSet* results) const
+{
+    std::string text;
+    for (int column : keyColumns) {
+        int         length = 0;
+        const char* value = results->getString(column, &length);
+        KEYSET_RESULT_SET::appendKey(text, value ? value : "", value ? length : 0);
+    }
+    return text;
+}
+
+// The rows of the last rowset hold handles from the query that read them,
+// which stays open until they're released.
+void KeysetResultSet::releaseRows()
+{
+    for (size_t n = 0; n < rows.size(); ++n) {
+        if (found[n]) {
+            releaseRow(rows[n]);
+        }
+    }
+    found.assign(rows.size(), false);
+    rowsStart = 0;
+
+    if (refetched) {
+        refetched->close();
+        refetched = nullptr;
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "RowStore.h"
+#include "ScrollableResultSet.h"
+
+class OdbcConnection;
+
+namespace NuoDB {
+class PreparedStatement;
+}
+
+/**
+ * The result set behind a keyset-driven cursor.  Only the primary key of
+ * each row of the base result set is kept, as text; the rows of a rowset
+ * are read again from the table when the cursor moves onto it, with a
+ * single query for the keys of the whole rowset.  A row whose key is no
+ * longer in the table reads as all NULL, and isDeleted().
+ *
+ * Keys are read from the base keysetSize at a time as the cursor needs
+ * them, or all at once if it's 0.  At most maxRows keys are kept, or all
+ * of them if it's 0.
+ */
+class KeysetResultSet : public ScrollableResultSet
+{
+public:
+    // Return nullptr if base isn't over the columns of a single table with
+    // a primary key, every column of which is in base.
+    static KeysetResultSet* open(OdbcConnection* connection, NuoDB::ResultSet* base, size_t memoryBudget,
+                                 size_t keysetSize, size_t maxRows);
+    virtual ~KeysetResultSet();
+
+    virtual bool   absolute(size_t row);
+    virtual void   seek(size_t row);
+    virtual void   setRowsetSize(size_t rows) { rowsetSize = rows > 0 ? rows : 1; }
+    virtual bool   isDeleted(size_t row);
+    virtual size_t getRowCount();
+    virtual size_t getRowsRead() const { return keys.getRowCount(); }
+
+    virtual void close();
+
+private:
+    KeysetResultSet(OdbcConnection* connection, NuoDB::ResultSet* base, const std::vector<int>& keyColumns,
+                    std::string&& select, size_t memoryBudget, size_t keysetSize, size_t maxRows);
+
+    void   fill(size_t count);
+    void   load(size_t first);
+    void   releaseRows();
+    std::string readKey(NuoDB::ResultSet* results) const;
+
+    OdbcConnection*           connection;
+    NuoDB::ResultSet*         base;
+    std::vector<int>          keyColumns;
+    std::string               select;       // the query up to the keys of a rowset
+    RowStore                  keys;
+    size_t                    keysetSize;
+    size_t                    maxRows;
+    bool                      exhausted = false;
+
+    NuoDB::PreparedStatement* refetch = nullptr;
+    size_t                    refetchKeys = 0;
+    NuoDB::ResultSet*         refetched = nullptr;
+    size_t                    rowsetSize = 1;
+    size_t                    rowsStart = 0;    // the row of rows[0], or 0
+    std::vector<StagedRow>    rows;
+    std::vector<bool>         found;
+};
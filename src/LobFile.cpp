@@ -0,0 +1,212 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+# include <io.h>
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include "LobFile.h"
+
+#include "LobStream.h"
+#include "OdbcTypeMapper.h"
+#include "ResultExport.h"
+
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/ResultSet.h"
+
+using namespace NuoDB;
+
+namespace LOB_FILE {
+
+static int closeFile(int fd)
+{
+#ifdef _WIN32
+    return _close(fd);
+#else
+    return ::close(fd);
+#endif
+}
+
+} // namespace LOB_FILE
+
+bool MappedFile::open(const char* path)
+{
+    close();
+
+#ifdef _WIN32
+    int fd = _open(path, _O_RDONLY | _O_BINARY);
+    if (fd < 0) {
+        return false;
+    }
+    struct _stat64 status;
+    if (_fstat64(fd, &status) < 0) {
+        LOB_FILE::closeFile(fd);
+        return false;
+    }
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) < 0) {
+        LOB_FILE::closeFile(fd);
+        return false;
+    }
+#endif
+
+    // the client takes a value's length as an int
+    if (status.st_size > INT_MAX) {
+        LOB_FILE::closeFile(fd);
+        errno = EFBIG;
+        return false;
+    }
+
+    length = (size_t)status.st_size;
+    if (length == 0) {
+        data = "";
+        LOB_FILE::closeFile(fd);
+        return true;
+    }
+
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA((HANDLE)_get_osfhandle(fd), NULL, PAGE_READONLY, 0, 0, NULL);
+    void*  view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, length) : NULL;
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    LOB_FILE::closeFile(fd);
+    if (!view) {
+        errno = EIO;
+        length = 0;
+        return false;
+    }
+#else
+    void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    LOB_FILE::closeFile(fd);
+    if (view == MAP_FAILED) {
+        length = 0;
+        return false;
+    }
+    madvise(view, length, MADV_SEQUENTIAL);
+#endif
+
+    data = (const char*)view;
+    mapped = true;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap((void*)data, length);
+#endif
+    }
+    data = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+namespace LobFile {
+
+const char* getPath(const void* buffer, SQLLEN bufferLength)
+{
+    if (!buffer || bufferLength <= 0 || !memchr(buffer, 0, bufferLength)) {
+        return nullptr;
+    }
+    return (const char*)buffer;
+}
+
+bool writeColumn(ResultSet* results, int column, int sqlType, SQLULEN maxLength, const char* path, SQLLEN* length)
+{
+    // The value is looked up before the file is opened, so that a NULL
+    // leaves it as it was.
+    LobStream   lob;
+    Bytes       bytes;
+    const char* text = nullptr;
+    SQLLEN      size = 0;
+
+    if (sqlType == (int)NUOSQL_BLOB) {
+        lob.open(results->getBlob(column), maxLength, false);
+        size = lob.getLength();
+    } else if (sqlType == (int)NUOSQL_CLOB) {
+        lob.open(results->getClob(column), maxLength, false);
+        size = lob.getLength();
+    } else if (OdbcTypeMapper::isInlineBinary(sqlType)) {
+        bytes = results->getBytes(column);
+        text = (const char*)bytes.data;
+        size = bytes.data ? bytes.length : 0;
+    } else {
+        int count = 0;
+        text = results->getString(column, &count);
+        size = text ? count : 0;
+    }
+
+    if (results->wasNull()) {
+        *length = SQL_NULL_DATA;
+        return true;
+    }
+    if (maxLength > 0 && size > (SQLLEN)maxLength) {
+        size = (SQLLEN)maxLength;
+    }
+
+#ifdef _WIN32
+    int fd = _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+#endif
+    if (fd < 0) {
+        return false;
+    }
+
+    OutputFile output(fd);
+    bool       written = true;
+    try {
+        if (lob.isOpen()) {
+            std::vector<char> chunk((size_t)std::min<SQLLEN>(size, LOB_FILE_CHUNK));
+            for (SQLLEN offset = 0; written && offset < size; offset += (SQLLEN)chunk.size()) {
+                SQLLEN count = std::min<SQLLEN>(size - offset, (SQLLEN)chunk.size());
+                lob.read(offset, chunk.data(), count);
+                output.queue(chunk.data(), count);
+                written = output.flush();
+            }
+        } else {
+            output.queue(text, size);
+            written = output.flush();
+        }
+    } catch (...) {
+        LOB_FILE::closeFile(fd);
+        throw;
+    }
+
+    bool closed = LOB_FILE::closeFile(fd) == 0;
+    if (!written) {
+        errno = output.getError();
+        return false;
+    }
+
+    *length = size;
+    return closed;
+}
+
+}
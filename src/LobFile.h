@@ -0,0 +1,63 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "OdbcBase.h"
+
+namespace NuoDB {
+class ResultSet;
+}
+
+// A file mapped into memory to be read: the value of a parameter bound as
+// SQL_C_NUODB_FILE (see NuoODBCFile.h), kept until the statement has been
+// executed with it.  Its pages are read in by the system as the client
+// copies them, rather than the driver reading the file into a buffer.
+class MappedFile final
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // False, with errno set, if the file can't be mapped.
+    bool        open(const char* path);
+    void        close();
+
+    const char* getData() const   { return data; }
+    size_t      getLength() const { return length; }
+
+private:
+    const char* data = nullptr;
+    size_t      length = 0;
+    bool        mapped = false;
+};
+
+// Columns fetched into files; see NuoODBCFile.h.
+namespace LobFile {
+
+// The bytes of a BLOB or CLOB copied to the file at a time.
+#define LOB_FILE_CHUNK (256 * 1024)
+
+// The path in a bound buffer of bufferLength bytes, or nullptr if it isn't
+// NUL-terminated within it.
+const char* getPath(const void* buffer, SQLLEN bufferLength);
+
+// Write the value of column in the current row of results, a column of SQL
+// type sqlType, to the file at path, replacing its contents.  A maxLength
+// other than 0 caps the bytes written, as SQL_ATTR_MAX_LENGTH does.  Sets
+// *length to the bytes written, or to SQL_NULL_DATA, without touching the
+// file, for a NULL.  Returns false, with errno set, if the file can't be
+// written; throws SQLException if results do.
+bool        writeColumn(NuoDB::ResultSet* results, int column, int sqlType, SQLULEN maxLength, const char* path,
+                        SQLLEN* length);
+
+}
@@ -0,0 +1,165 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <string.h>
+#include <algorithm>
+
+#include "LobStream.h"
+
+#include "Transcoder.h"
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Clob.h"
+
+// Small buffers still read ahead this much, so that a value isn't fetched
+// a few bytes at a time.
+#define MIN_READ_AHEAD 8192
+
+// The longest UTF-8 sequence.
+#define MAX_SEQUENCE 4
+
+void LobStream::open(NuoDB::Blob* value, SQLULEN maxLength, bool ahead)
+{
+    close();
+
+    blob = value;
+    length = blob ? blob->length() : 0;
+    if (maxLength > 0 && length > (SQLLEN)maxLength) {
+        length = (SQLLEN)maxLength;
+        capped = true;
+    }
+    readAhead = ahead;
+    opened = true;
+}
+
+void LobStream::open(NuoDB::Clob* value, SQLULEN maxLength, bool ahead)
+{
+    close();
+
+    clob = value;
+    length = clob ? clob->length() : 0;
+    if (maxLength > 0 && length > (SQLLEN)maxLength) {
+        length = (SQLLEN)maxLength;
+        capped = true;
+    }
+    readAhead = ahead;
+    opened = true;
+}
+
+void LobStream::close()
+{
+    if (blob) {
+        blob->release();
+        blob = nullptr;
+    }
+    if (clob) {
+        clob->release();
+        clob = nullptr;
+    }
+    std::vector<unsigned char>().swap(window);
+    windowStart = 0;
+    length = 0;
+    consumed = 0;
+    pendingLow = 0;
+    capped = false;
+    opened = false;
+}
+
+void LobStream::fetch(SQLLEN position, SQLLEN count, unsigned char* out)
+{
+    if (blob) {
+        blob->getBytes((int)position, (int)count, out);
+    } else {
+        clob->getChars((int)position, (int)count, (char*)out);
+    }
+}
+
+// Replace the window with count bytes from position.
+void LobStream::fill(SQLLEN position, SQLLEN count)
+{
+    window.resize(count);
+    fetch(position, count, window.data());
+    windowStart = position;
+}
+
+void LobStream::read(SQLLEN offset, char* out, SQLLEN count)
+{
+    SQLLEN copied = 0;
+
+    // first whatever was read ahead
+    SQLLEN windowEnd = windowStart + (SQLLEN)window.size();
+    if (offset >= windowStart && offset < windowEnd) {
+        copied = std::min(count, windowEnd - offset);
+        memcpy(out, window.data() + (offset - windowStart), copied);
+    }
+
+    if (copied == count) {
+        return;
+    }
+
+    SQLLEN position = offset + copied;
+    SQLLEN wanted = count - copied;
+    SQLLEN ahead = readAhead ? std::min(std::max<SQLLEN>(count, MIN_READ_AHEAD), length - position - wanted) : 0;
+
+    if (ahead <= 0) {
+        // the rest of the value fits: no need to go through the window
+        fetch(position, wanted, (unsigned char*)out + copied);
+        window.clear();
+        return;
+    }
+
+    fill(position, wanted + ahead);
+    memcpy(out + copied, window.data(), wanted);
+}
+
+bool LobStream::readWide(char16_t* out, size_t capacity, size_t* written)
+{
+    size_t units = 0;
+
+    while (units < capacity) {
+        if (pendingLow) {
+            out[units++] = pendingLow;
+            pendingLow = 0;
+            continue;
+        }
+
+        if (consumed == length) {
+            break;
+        }
+
+        // keep whole sequences in the window: refill it once it runs low
+        SQLLEN windowEnd = windowStart + (SQLLEN)window.size();
+        if (consumed < windowStart || consumed >= windowEnd || (windowEnd - consumed < MAX_SEQUENCE && windowEnd < length)) {
+            SQLLEN size = std::max<SQLLEN>(2 * (SQLLEN)capacity, MIN_READ_AHEAD);
+            fill(consumed, std::min(size, length - consumed));
+            windowEnd = windowStart + (SQLLEN)window.size();
+        }
+
+        size_t used;
+        size_t stored;
+        if (!Transcoder::utf8ToUtf16Piece((const char*)window.data() + (consumed - windowStart), windowEnd - consumed,
+                                          out + units, capacity - units, &used, &stored, &pendingLow)) {
+            return false;
+        }
+
+        if (!used && !stored) {
+            // a sequence cut off by the end of the value: only a cap can
+            // do that to valid data
+            if (!capped) {
+                return false;
+            }
+            consumed = length;
+            break;
+        }
+
+        consumed += used;
+        units += stored;
+    }
+
+    *written = units;
+    return true;
+}
@@ -0,0 +1,71 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "OdbcBase.h"
+
+namespace NuoDB {
+class Blob;
+class Clob;
+}
+
+// A BLOB or CLOB value being read in pieces.  The stream keeps the client's
+// Blob or Clob for one column of one row, so that a value read with several
+// SQLGetData calls is looked up once, and reads it a range at a time: each
+// read also reads ahead by the size of the caller's buffer (at least 8K), so
+// that only about two buffers' worth of the value is ever held by the
+// driver.  A CLOB is read as UTF-8 bytes; readWide() transcodes it to
+// UTF-16 a piece at a time.
+class LobStream final
+{
+public:
+    LobStream() = default;
+    ~LobStream() { close(); }
+
+    LobStream(const LobStream&) = delete;
+    LobStream& operator=(const LobStream&) = delete;
+
+    // Take over blob or clob (and its reference).  A maxLength other than 0
+    // caps the length of the value in bytes, as SQL_ATTR_MAX_LENGTH does.
+    void   open(NuoDB::Blob* blob, SQLULEN maxLength, bool readAhead);
+    void   open(NuoDB::Clob* clob, SQLULEN maxLength, bool readAhead);
+    void   close();
+    bool   isOpen() const    { return opened; }
+
+    SQLLEN getLength() const { return length; }
+
+    // Copy count bytes from offset, which have to be within the value.
+    void   read(SQLLEN offset, char* out, SQLLEN count);
+
+    // Transcode the next piece of a CLOB, storing at most capacity units.
+    // Returns false if the value isn't valid UTF-8.
+    bool   readWide(char16_t* out, size_t capacity, size_t* written);
+    bool   isWideDone() const { return consumed == length && !pendingLow; }
+
+private:
+    void   fetch(SQLLEN position, SQLLEN count, unsigned char* out);
+    void   fill(SQLLEN position, SQLLEN count);
+
+    NuoDB::Blob*               blob = nullptr;
+    NuoDB::Clob*               clob = nullptr;
+    SQLLEN                     length = 0;
+    bool                       capped = false;
+    bool                       opened = false;
+    bool                       readAhead = false;
+
+    // the range read ahead of the caller
+    std::vector<unsigned char> window;
+    SQLLEN                     windowStart = 0;
+
+    // readWide: the bytes transcoded so far, and the second half of a
+    // surrogate pair that didn't fit
+    SQLLEN                     consumed = 0;
+    char16_t                   pendingLow = 0;
+};
@@ -16,6 +16,8 @@
 #include "OdbcEnv.h"
 #include "OdbcConnection.h"
 #include "OdbcStatement.h"
+#include "NuoODBCArrow.h"
+#include "NuoODBCExport.h"
 
 #include "NuoRemote/CallableStatement.h"
 #include "NuoRemote/Connection.h"
@@ -143,6 +145,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLBindCol(HSTMT arg0,
 {
     TRACE("SQLBindCol");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlBindCol(arg1, arg2, arg3, PROTECT_SQLLEN(arg4), arg5);
     TRACERET("SQLBindCol", retcode);
     return retcode;
@@ -171,6 +174,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLColAttributes(HSTMT arg0,
 {
     TRACE("SQLColAttributes");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlColAttributes(arg1, arg2, arg3, arg4, arg5, arg6);
     TRACERET("SQLColAttributes", retcode);
     return retcode;
@@ -188,6 +192,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLColAttribute(SQLHSTMT handle,
     )
 {
     TRACE(formatString("SQLColAttribute: column %u attr %u", columnNumber, fieldIdentifier).c_str());
+    ClientGate::Use use(((OdbcStatement*)handle)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)handle)->sqlColAttribute(columnNumber, fieldIdentifier, characterAttrPtr, bufferLen, stringLengthPtr, numericAttrPtr);
     TRACERET("SQLColAttribute", retcode);
     return retcode;
@@ -205,6 +210,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLConnect(HDBC arg0,
 {
     TRACE("SQLConnect");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlConnect(arg1, arg2, arg3, arg4, arg5, arg6);
     TRACERET("SQLConnect", retcode);
     return retcode;
@@ -224,6 +230,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLDescribeCol(HSTMT arg0,
 {
     TRACE("SQLDescribeCol");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlDescribeCol(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     TRACERET("SQLDescribeCol", retcode);
     return retcode;
@@ -235,6 +242,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLDisconnect(HDBC arg0)
 {
     TRACE("SQLDisconnect");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlDisconnect();
     TRACERET("SQLDisconnect", retcode);
     return retcode;
@@ -276,6 +284,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLExecDirect(HSTMT arg0,
 {
     TRACE("SQLExecDirect");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlExecuteDirect(arg1, arg2);
     TRACERET("SQLExecDirect", retcode);
     return retcode;
@@ -287,6 +296,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLExecute(HSTMT arg0)
 {
     TRACE("SQLExecute");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlExecute();
     TRACERET("SQLExecute", retcode);
     return retcode;
@@ -303,6 +313,7 @@ static RETCODE _SQLFetch(HSTMT arg0)
 {
     TRACE("SQLFetch");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlFetch();
     TRACERET("SQLFetch", retcode);
     return retcode;
@@ -343,6 +354,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLFreeStmt(HSTMT arg0,
         return retcode;
     }
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlFreeStmt(arg1);
     TRACERET("SQLFreeStmt", retcode);
     return retcode;
@@ -354,6 +366,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLNumResultCols(HSTMT arg0, SQLSMALLINT* arg1)
 {
     TRACE("SQLNumResultCols");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlNumResultCols(arg1);
     TRACERET("SQLNumResultCols", retcode);
     return retcode;
@@ -367,6 +380,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLPrepare(HSTMT arg0,
 {
     TRACE("SQLPrepare");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlPrepare(arg1, arg2);
     TRACERET("SQLPrepare", retcode);
     return retcode;
@@ -378,6 +392,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLRowCount(HSTMT arg0, SQLLEN* arg1)
 {
     TRACE("SQLRowCount");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlRowCount(arg1);
     TRACERET("SQLRowCount", retcode);
     return retcode;
@@ -448,6 +463,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLColumns(HSTMT arg0,
                                          SQLSMALLINT arg8)
 {
     TRACE("SQLColumns");
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlColumns(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     TRACERET("SQLColumns", retcode);
     return retcode;
@@ -466,6 +482,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLDriverConnect(HDBC arg0,
 {
     TRACE("SQLDriverConnect");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlDriverConnect(
         hWnd, szConnStrIn, cbConnStrIn,
         szConnStrOut, cbConnStrOut, pcbConnStrOut,
@@ -495,6 +512,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetData(HSTMT arg0,
 {
     TRACE("SQLGetData");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlGetData(arg1, arg2, arg3, PROTECT_SQLLEN(arg4), arg5);
     TRACERET(formatString("SQLGetData with length " SQLLEN_FMT, arg5 ? *arg5 : (SQLLEN)-1).c_str(), retcode);
     return retcode;
@@ -508,6 +526,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetFunctions(HDBC arg0,
 {
     TRACE("SQLGetFunctions");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlGetFunctions(arg1, arg2);
     TRACERET("SQLGetFunctions", retcode);
     return retcode;
@@ -523,6 +542,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetInfo(HDBC arg0,
 {
     TRACE("SQLGetInfo");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlGetInfo(arg1, arg2, arg3, arg4);
     TRACERET("SQLGetInfo", retcode);
     return retcode;
@@ -544,6 +564,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetTypeInfo(HSTMT arg0,
 {
     TRACE("SQLGetTypeInfo");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlGetTypeInfo(arg1);
     TRACERET("SQLGetTypeInfo", retcode);
     return retcode;
@@ -556,6 +577,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLParamData(HSTMT arg0,
 {
     TRACE("SQLParamData");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlParamData(arg1);
     TRACERET("SQLParamData", retcode);
     return retcode;
@@ -569,6 +591,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLPutData(HSTMT arg0,
 {
     TRACE("SQLPutData");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlPutData(arg1, PROTECT_SQLLEN(arg2));
     TRACERET("SQLPutData", retcode);
     return retcode;
@@ -639,6 +662,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLStatistics(HSTMT arg0,
 {
     TRACE("SQLStatistics");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlStatistics(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     TRACERET("SQLStatistics", retcode);
     return retcode;
@@ -657,6 +681,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLTables(HSTMT arg0,
                                         SQLSMALLINT arg8)
 {
     TRACE("SQLTables");
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlTables(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     TRACERET("SQLTables", retcode);
     return retcode;
@@ -672,6 +697,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLBrowseConnect(SQLHDBC connectionHandle,
                                                SQLSMALLINT* stringLength2Ptr)
 {
     TRACE(formatString("SQLBrowseConnect with (%s)", std::string((const char*)inConnectionString, stringLength1).c_str()).c_str());
+    ClientGate::Use use(((OdbcConnection*)connectionHandle)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)connectionHandle)->sqlBrowseConnect(inConnectionString,
                                                                             stringLength1,
                                                                             outConnectionString,
@@ -722,6 +748,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLDescribeParam(HSTMT arg0,
 {
     TRACE("SQLDescribeParam");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlDescribeParam(arg1, arg2, arg3, arg4, arg4);
     TRACERET("SQLDescribeParam", retcode);
     return retcode;
@@ -735,7 +762,12 @@ RETCODE NUODB_ODBCAPI SQL_API SQLExtendedFetch(HSTMT arg0,
                                                SQLULEN* arg3,
                                                SQLUSMALLINT* arg4)
 {
-    return notYetImplemented((OdbcObject*)arg0, "SQLExtendedFetch called");
+    TRACE("SQLExtendedFetch");
+
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
+    RETCODE retcode = ((OdbcStatement*)arg0)->sqlExtendedFetch(arg1, arg2, arg3, arg4);
+    TRACERET("SQLExtendedFetch", retcode);
+    return retcode;
 }
 
 ///// SQLForeignKeys /////
@@ -754,6 +786,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLForeignKeys(HSTMT arg0,
                                              SQLCHAR* arg11,
                                              SQLSMALLINT arg12)
 {
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     return ((OdbcStatement*)arg0)->sqlForeignKeys(arg1, arg2, arg3, arg4,
                                                   arg5, arg6, arg7, arg8,
                                                   arg9, arg10, arg11, arg12);
@@ -764,6 +797,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLForeignKeys(HSTMT arg0,
 RETCODE NUODB_ODBCAPI SQL_API SQLMoreResults(HSTMT arg0)
 {
     TRACE("SQLMoreResults");
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlMoreResults();
     TRACERET("SQLMoreResults", retcode);
     return retcode;
@@ -786,6 +820,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLNativeSql(HDBC arg0,
 RETCODE NUODB_ODBCAPI SQL_API SQLNumParams(HSTMT arg0,
                                            SQLSMALLINT* arg1)
 {
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     return ((OdbcStatement*)arg0)->sqlNumParameters(arg1);
 }
 
@@ -810,6 +845,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLPrimaryKeys(HSTMT arg0,
 {
     TRACE("SQLPrimaryKeys");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlPrimaryKeys(arg1, arg2, arg3, arg4, arg5, arg6);
     TRACERET("SQLPrimaryKeys", retcode);
     return retcode;
@@ -829,6 +865,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLProcedureColumns(HSTMT arg0,
 {
     TRACE("SQLProcedureColumns");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlProcedureColumns(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     TRACERET("SQLProcedureColumns", retcode);
     return retcode;
@@ -846,6 +883,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLProcedures(HSTMT arg0,
 {
     TRACE("SQLProcedures");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlProcedures(arg1, arg2, arg3, arg4, arg5, arg6);
     TRACERET("SQLProcedures", retcode);
     return retcode;
@@ -858,7 +896,12 @@ RETCODE NUODB_ODBCAPI SQL_API SQLSetPos(HSTMT arg0,
                                         SQLUSMALLINT arg2,
                                         SQLUSMALLINT arg3)
 {
-    return notYetImplemented((OdbcObject*)arg0, "SQLSetPos called");
+    TRACE("SQLSetPos");
+
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
+    RETCODE retcode = ((OdbcStatement*)arg0)->sqlSetPos(arg1, arg2, arg3);
+    TRACERET("SQLSetPos", retcode);
+    return retcode;
 }
 
 ///// SQLSetScrollOptions /////
@@ -914,6 +957,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLBindParameter(SQLHSTMT arg0,
 {
     TRACE("SQLBindParameter");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlBindParameter(arg1, arg2, arg3, arg4, arg5, arg6, arg7, PROTECT_SQLLEN(arg8), arg9);
     TRACERET("SQLBindParameter", retcode);
     return retcode;
@@ -972,6 +1016,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLCloseCursor(SQLHSTMT arg0)
 {
     TRACE("SQLCloseCursor");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlCloseCursor();
     TRACERET("SQLCloseCursor", retcode);
     return retcode;
@@ -1009,6 +1054,7 @@ static RETCODE _SQLEndTran(SQLSMALLINT arg0,
         }
 
         case SQL_HANDLE_DBC: {
+            ClientGate::Use use(((OdbcConnection*)arg1)->getClientGate());
             RETCODE retcode = ((OdbcConnection*)arg1)->sqlEndTran(arg2);
             TRACERET("SQLEndTran", retcode);
             return retcode;
@@ -1024,13 +1070,12 @@ RETCODE NUODB_ODBCAPI SQL_API SQLFetchScroll(SQLHSTMT handle,
                                              SQLSMALLINT fetchOrientation,
                                              SQLLEN fetchOffset)
 {
-    switch (fetchOrientation) {
-        case SQL_FETCH_NEXT:
-            return _SQLFetch(handle);
+    TRACE("SQLFetchScroll");
 
-        default:
-            return ((OdbcObject*)handle)->sqlReturn(SQL_ERROR, "HY106", "Invalid fetch type.  Only SQL_FETCH_NEXT supported");
-    }
+    ClientGate::Use use(((OdbcStatement*)handle)->getClientGate());
+    RETCODE retcode = ((OdbcStatement*)handle)->sqlFetchScroll(fetchOrientation, fetchOffset);
+    TRACERET("SQLFetchScroll", retcode);
+    return retcode;
 }
 
 ///// SQLFreeHandle /////
@@ -1049,9 +1094,11 @@ RETCODE NUODB_ODBCAPI SQL_API SQLFreeHandle(SQLSMALLINT arg0,
             delete (OdbcConnection*)arg1;
             break;
 
-        case SQL_HANDLE_STMT:
+        case SQL_HANDLE_STMT: {
+            ClientGate::Use use(((OdbcStatement*)arg1)->getClientGate());
             delete (OdbcStatement*)arg1;
             break;
+        }
 
         case SQL_HANDLE_DESC:
             notYetImplemented("SQLFreeHandle DESC");
@@ -1075,6 +1122,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetConnectAttr(SQLHDBC arg0,
 {
     TRACE("SQLGetConnectAttr");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlGetConnectAttr(arg1, arg2, arg3, arg4);
     TRACERET("SQLGetConnectAttr", retcode);
     return retcode;
@@ -1171,6 +1219,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLGetStmtAttr(SQLHSTMT arg0,
 {
     TRACE("SQLGetStmtAttr");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlGetStmtAttr(arg1, arg2, arg3, arg4);
     TRACERET("SQLGetStmtAttr", retcode);
     return retcode;
@@ -1185,6 +1234,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLSetConnectAttr(SQLHDBC arg0,
 {
     TRACE("SQLSetConnectAttr");
 
+    ClientGate::Use use(((OdbcConnection*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcConnection*)arg0)->sqlSetConnectAttr(arg1, arg2, arg3);
     TRACERET("SQLSetConnectAttr", retcode);
     return retcode;
@@ -1245,6 +1295,7 @@ RETCODE NUODB_ODBCAPI SQL_API SQLSetStmtAttr(SQLHSTMT arg0,
 {
     TRACE("SQLSetStmtAttr");
 
+    ClientGate::Use use(((OdbcStatement*)arg0)->getClientGate());
     RETCODE retcode = ((OdbcStatement*)arg0)->sqlSetStmtAttr(arg1, arg2, arg3);
     TRACERET("SQLSetStmtAttr", retcode);
     return retcode;
@@ -1258,3 +1309,35 @@ RETCODE NUODB_ODBCAPI SQL_API SQLBulkOperations(SQLHSTMT arg0,
     notYetImplemented("SQLBulkOperations called");
     return SQL_SUCCESS;
 }
+
+///// NuoODBCFetchArrow /////
+
+// A driver extension, see NuoODBCArrow.h.
+SQLRETURN NUODB_ODBCAPI SQL_API NuoODBCFetchArrow(SQLHSTMT statement,
+                                                SQLULEN batchRows,
+                                                struct ArrowSchema* schema,
+                                                struct ArrowArray* batch)
+{
+    TRACE("NuoODBCFetchArrow");
+
+    ClientGate::Use use(((OdbcStatement*)statement)->getClientGate());
+    RETCODE retcode = ((OdbcStatement*)statement)->sqlFetchArrow(batchRows, schema, batch);
+    TRACERET("NuoODBCFetchArrow", retcode);
+    return retcode;
+}
+
+///// NuoODBCExport /////
+
+// A driver extension, see NuoODBCExport.h.
+SQLRETURN NUODB_ODBCAPI SQL_API NuoODBCExport(SQLHSTMT statement,
+                                            int fd,
+                                            const NuoODBCExportOptions* options,
+                                            SQLLEN* rowCount)
+{
+    TRACE("NuoODBCExport");
+
+    ClientGate::Use use(((OdbcStatement*)statement)->getClientGate());
+    RETCODE retcode = ((OdbcStatement*)statement)->sqlExport(fd, options, rowCount);
+    TRACERET("NuoODBCExport", retcode);
+    return retcode;
+}
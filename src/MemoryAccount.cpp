@@ -0,0 +1,79 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include "MemoryAccount.h"
+
+namespace MEMORY_ACCOUNT {
+
+static const char* useNames[] = { "parameters", "getdata", "rowsets", "prefetch", "cursors" };
+
+static_assert(sizeof(useNames) / sizeof(useNames[0]) == (size_t)MemoryUse::Count, "a name for each MemoryUse");
+
+} // namespace MEMORY_ACCOUNT
+
+MemoryAccount::MemoryAccount()
+{
+    for (auto& count : used) {
+        count = 0;
+    }
+}
+
+bool MemoryAccount::charge(MemoryUse use, size_t bytes, bool force)
+{
+    size_t current = total;
+    size_t bound = limit;
+    do {
+        if (!force && bound > 0 && (bytes > bound || current > bound - bytes)) {
+            return false;
+        }
+    } while (!total.compare_exchange_weak(current, current + bytes));
+
+    used[(int)use] += bytes;
+
+    size_t highest = peak;
+    while (current + bytes > highest && !peak.compare_exchange_weak(highest, current + bytes)) {
+    }
+
+    return true;
+}
+
+void MemoryAccount::credit(MemoryUse use, size_t bytes)
+{
+    used[(int)use] -= bytes;
+    total -= bytes;
+}
+
+std::string MemoryAccount::describe() const
+{
+    std::string text;
+    for (int n = 0; n < (int)MemoryUse::Count; ++n) {
+        text += MEMORY_ACCOUNT::useNames[n];
+        text += '=';
+        text += std::to_string((size_t)used[n]);
+        text += ';';
+    }
+    text += "peak=";
+    text += std::to_string((size_t)peak);
+
+    return text;
+}
+
+bool MemoryCharge::change(size_t newBytes, bool force)
+{
+    if (account) {
+        if (newBytes > bytes) {
+            if (!account->charge(use, newBytes - bytes, force)) {
+                return false;
+            }
+        } else if (newBytes < bytes) {
+            account->credit(use, bytes - newBytes);
+        }
+    }
+    bytes = newBytes;
+
+    return true;
+}
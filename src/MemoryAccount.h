@@ -0,0 +1,95 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <atomic>
+#include <string>
+
+// What the memory charged to a connection is held for.
+enum class MemoryUse : int
+{
+    Parameters,     // parameter values put together for an execute
+    GetData,        // column values kept while SQLGetData reads them in pieces
+    Rowsets,        // the rows of a block cursor's rowset kept for SQLGetData
+    Prefetch,       // batches of rows read ahead of the application
+    Cursors,        // the rows or keys of static and keyset-driven cursors
+    Count
+};
+
+/**
+ * The bytes a connection's statements hold in the driver's own buffers, by
+ * what they're held for, so that where the memory goes can be seen with
+ * SQL_ATTR_NUODB_MEMORY_USAGE.  With a limit, set by MemoryLimit in the
+ * connection string or SQL_ATTR_NUODB_MEMORY_LIMIT, a buffer that would
+ * take the total past it isn't charged; the buffer is then done without,
+ * or spilled to a file, or the call that wanted it fails with HY001.
+ *
+ * Buffers are charged from the prefetch and worker threads as well as the
+ * application's, so the counts are atomic.
+ */
+class MemoryAccount final
+{
+public:
+    MemoryAccount();
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    // 0 for no limit.
+    void        setLimit(size_t bytes)  { limit = bytes; }
+    size_t      getLimit() const        { return limit; }
+
+    size_t      getUsed() const         { return total; }
+    size_t      getUsed(MemoryUse use) const { return used[(int)use]; }
+    size_t      getPeak() const         { return peak; }
+
+    // Add bytes for use: false, adding nothing, if they'd take the total
+    // past the limit, unless force.
+    bool        charge(MemoryUse use, size_t bytes, bool force = false);
+    void        credit(MemoryUse use, size_t bytes);
+
+    // The bytes used for each use, and the peak, as name=value pairs.
+    std::string describe() const;
+
+private:
+    std::atomic<size_t> used[(int)MemoryUse::Count];
+    std::atomic<size_t> total { 0 };
+    std::atomic<size_t> peak { 0 };
+    std::atomic<size_t> limit { 0 };
+};
+
+// The bytes charged to an account for one buffer, credited back when it's
+// destroyed.  A charge without an account counts the bytes and nothing more.
+class MemoryCharge final
+{
+public:
+    MemoryCharge() = default;
+    MemoryCharge(MemoryAccount* account, MemoryUse use) : account(account), use(use) {}
+    ~MemoryCharge() { force(0); }
+
+    MemoryCharge(const MemoryCharge&) = delete;
+    MemoryCharge& operator=(const MemoryCharge&) = delete;
+
+    // Only while nothing is charged.
+    void   attach(MemoryAccount* newAccount, MemoryUse newUse) { account = newAccount; use = newUse; }
+
+    // Charge bytes in all, up or down from what's charged now: false,
+    // leaving the charge as it was, if the account's limit won't allow it.
+    bool   set(size_t bytes) { return change(bytes, false); }
+    void   force(size_t bytes) { change(bytes, true); }
+
+    size_t get() const { return bytes; }
+
+private:
+    bool   change(size_t newBytes, bool force);
+
+    MemoryAccount* account = nullptr;
+    MemoryUse      use = MemoryUse::Parameters;
+    size_t         bytes = 0;
+};
@@ -0,0 +1,273 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Numeric.h"
+
+#define CHUNK_DIGITS 9
+#define CHUNK_BASE   1000000000u
+
+// Exponents beyond this can't produce a value that fits anyway.
+#define MAX_EXPONENT 10000
+
+namespace NUMERIC {
+
+static const uint32_t powersOfTen[CHUNK_DIGITS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// The mantissa is held as four 32-bit limbs, least significant first, so
+// that every step is a 32x32->64 bit multiply or divide on any compiler.
+#define LIMBS 4
+
+static void multiplyAdd(uint32_t* limbs, uint32_t multiplier, uint32_t addend)
+{
+    uint64_t carry = addend;
+    for (int n = 0; n < LIMBS; ++n) {
+        uint64_t product = (uint64_t)limbs[n] * multiplier + carry;
+        limbs[n] = (uint32_t)product;
+        carry = product >> 32;
+    }
+}
+
+static uint32_t divide(uint32_t* limbs, uint32_t divisor)
+{
+    uint64_t remainder = 0;
+    for (int n = LIMBS - 1; n >= 0; --n) {
+        uint64_t dividend = (remainder << 32) | limbs[n];
+        limbs[n] = (uint32_t)(dividend / divisor);
+        remainder = dividend % divisor;
+    }
+    return (uint32_t)remainder;
+}
+
+static bool isZero(const uint32_t* limbs)
+{
+    return !(limbs[0] | limbs[1] | limbs[2] | limbs[3]);
+}
+
+static bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+} // namespace NUMERIC
+
+namespace Numeric {
+
+using namespace NUMERIC;
+
+Status fromString(const char* text, size_t length, int precision, int scale, SQL_NUMERIC_STRUCT* numeric)
+{
+    const char* p = text;
+    const char* end = text + length;
+
+    while (p < end && isSpace(*p)) {
+        ++p;
+    }
+    while (end > p && isSpace(end[-1])) {
+        --end;
+    }
+
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p++ == '-';
+    }
+
+    const char* integer = p;
+    while (p < end && isDigit(*p)) {
+        ++p;
+    }
+    int integerDigits = (int)(p - integer);
+
+    const char* fraction = p;
+    int         fractionDigits = 0;
+    if (p < end && *p == '.') {
+        fraction = ++p;
+        while (p < end && isDigit(*p)) {
+            ++p;
+        }
+        fractionDigits = (int)(p - fraction);
+    }
+
+    if (integerDigits + fractionDigits == 0) {
+        return Status::Invalid;
+    }
+
+    int exponent = 0;
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        bool negativeExponent = false;
+        if (++p < end && (*p == '+' || *p == '-')) {
+            negativeExponent = *p++ == '-';
+        }
+        if (p == end || !isDigit(*p)) {
+            return Status::Invalid;
+        }
+        for (; p < end && isDigit(*p); ++p) {
+            if (exponent < MAX_EXPONENT) {
+                exponent = exponent * 10 + (*p - '0');
+            }
+        }
+        if (negativeExponent) {
+            exponent = -exponent;
+        }
+    }
+
+    if (p != end) {
+        return Status::Invalid;
+    }
+
+    if (precision < 1 || precision > NUMERIC_MAX_PRECISION) {
+        precision = NUMERIC_MAX_PRECISION;
+    }
+
+    // The digits read are one run, integer then fraction; the mantissa is
+    // that run times 10^shift, dropping digits when shift is negative.
+    int total = integerDigits + fractionDigits;
+    int shift = exponent - fractionDigits + scale;
+    int kept = shift < 0 ? total + shift : total;
+    int appended = shift > 0 ? shift : 0;
+
+    auto digitAt = [&](int index) {
+        return index < integerDigits ? integer[index] : fraction[index - integerDigits];
+    };
+
+    int first = 0;
+    while (first < kept && digitAt(first) == '0') {
+        ++first;
+    }
+
+    if (first < kept && kept - first + appended > precision) {
+        return Status::OutOfRange;
+    }
+
+    Status status = Status::Ok;
+    for (int n = kept > 0 ? kept : 0; n < total; ++n) {
+        if (digitAt(n) != '0') {
+            status = Status::FractionTruncated;
+            break;
+        }
+    }
+
+    uint32_t limbs[LIMBS] = {};
+    uint32_t chunk = 0;
+    int      chunkDigits = 0;
+
+    for (int n = first; n < kept; ++n) {
+        chunk = chunk * 10 + (uint32_t)(digitAt(n) - '0');
+        if (++chunkDigits == CHUNK_DIGITS) {
+            multiplyAdd(limbs, CHUNK_BASE, chunk);
+            chunk = 0;
+            chunkDigits = 0;
+        }
+    }
+    if (chunkDigits) {
+        multiplyAdd(limbs, powersOfTen[chunkDigits], chunk);
+    }
+
+    if (first < kept) {
+        for (int zeros = appended; zeros > 0; zeros -= CHUNK_DIGITS) {
+            multiplyAdd(limbs, powersOfTen[zeros < CHUNK_DIGITS ? zeros : CHUNK_DIGITS], 0);
+        }
+    }
+
+    numeric->precision = (SQLCHAR)precision;
+    numeric->scale = (SQLSCHAR)scale;
+    numeric->sign = (negative && !isZero(limbs)) ? 0 : 1;
+    for (int n = 0; n < SQL_MAX_NUMERIC_LEN; ++n) {
+        numeric->val[n] = (SQLCHAR)(limbs[n / 4] >> (8 * (n % 4)));
+    }
+
+    return status;
+}
+
+void toString(const SQL_NUMERIC_STRUCT* numeric, int scale, std::string& text)
+{
+    uint32_t limbs[LIMBS] = {};
+    for (int n = 0; n < SQL_MAX_NUMERIC_LEN; ++n) {
+        limbs[n / 4] |= (uint32_t)numeric->val[n] << (8 * (n % 4));
+    }
+
+    bool negative = numeric->sign == 0 && !isZero(limbs);
+
+    // split into base 10^9 chunks, least significant first
+    uint32_t chunks[5];
+    int      count = 0;
+    do {
+        chunks[count++] = divide(limbs, CHUNK_BASE);
+    } while (!isZero(limbs));
+
+    char digits[64];
+    int  length = snprintf(digits, sizeof(digits), "%u", chunks[count - 1]);
+    for (int n = count - 2; n >= 0; --n) {
+        length += snprintf(digits + length, sizeof(digits) - length, "%09u", chunks[n]);
+    }
+
+    text.clear();
+    if (negative) {
+        text += '-';
+    }
+
+    if (scale <= 0) {
+        text.append(digits, length);
+        if (length > 1 || digits[0] != '0') {
+            text.append(-scale, '0');
+        }
+    } else if (length > scale) {
+        text.append(digits, length - scale);
+        text += '.';
+        text.append(digits + length - scale, scale);
+    } else {
+        text += "0.";
+        text.append(scale - length, '0');
+        text.append(digits, length);
+    }
+}
+
+const char* getSqlState(Status status)
+{
+    switch (status) {
+        case Status::FractionTruncated:
+            return "01S07";
+
+        case Status::OutOfRange:
+            return "22003";
+
+        case Status::Invalid:
+            return "22018";
+
+        default:
+            return "00000";
+    }
+}
+
+const char* getMessage(Status status)
+{
+    switch (status) {
+        case Status::FractionTruncated:
+            return "Fractional truncation";
+
+        case Status::OutOfRange:
+            return "Numeric value out of range";
+
+        case Status::Invalid:
+            return "Invalid character value for cast specification";
+
+        default:
+            return "";
+    }
+}
+
+}
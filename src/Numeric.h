@@ -0,0 +1,45 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+#include "OdbcBase.h"
+
+// Conversion between the decimal text of a NUMERIC/DECIMAL value, which is
+// how the NuoDB client hands those out and takes them in, and
+// SQL_NUMERIC_STRUCT.  The mantissa is built from and split into base 10^9
+// chunks so that a 38 digit value takes a handful of 128-bit steps rather
+// than one per digit.
+namespace Numeric {
+
+// The largest precision a SQL_NUMERIC_STRUCT can hold.
+#define NUMERIC_MAX_PRECISION 38
+
+enum class Status
+{
+    Ok,
+    FractionTruncated,  // 01S07
+    OutOfRange,         // 22003
+    Invalid,            // 22018
+};
+
+// Parse text and scale it to 'scale' digits after the point; fractional
+// digits beyond that are dropped.  The value may have at most 'precision'
+// digits once scaled.
+Status fromString(const char* text, size_t length, int precision, int scale, SQL_NUMERIC_STRUCT* numeric);
+
+// Format numeric with 'scale' digits after the point.
+void   toString(const SQL_NUMERIC_STRUCT* numeric, int scale, std::string& text);
+
+// The diagnostic for a status other than Ok.
+const char* getSqlState(Status status);
+const char* getMessage(Status status);
+
+}
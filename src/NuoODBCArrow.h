@@ -0,0 +1,99 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+/*
+ * A NuoDB ODBC driver extension: the rows of a result set as Arrow record
+ * batches, written straight from the NuoDB client's values rather than
+ * through a rowset.
+ *
+ * The entry point is found in the driver library itself (dlsym or
+ * GetProcAddress), and takes the driver's own statement handle, which
+ * SQLGetInfo(SQL_DRIVER_HSTMT) returns for a Driver Manager's one.
+ */
+
+#include <stdint.h>
+
+#include <sql.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The Arrow C Data Interface, as defined by the Arrow project. */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif  /* ARROW_C_DATA_INTERFACE */
+
+/*
+ * Read up to batchRows rows following the cursor of a statement's
+ * forward-only result set into batch, a struct array with a child for
+ * each column; schema, if not NULL, is given its type.  Both are the
+ * caller's to release.  Returns SQL_NO_DATA, leaving them untouched, once
+ * there are no more rows.
+ *
+ * Columns are typed as follows:
+ *   BIT, BOOLEAN             b
+ *   TINYINT ... BIGINT       c, s, i, l
+ *   REAL, FLOAT, DOUBLE      f, g
+ *   DECIMAL, NUMERIC         d:precision,scale (decimal128), or u if that can't hold them
+ *   DATE                     tdD
+ *   TIME                     ttu
+ *   TIMESTAMP                tsu:UTC, or tsu: without a time zone
+ *   character types, CLOB    U (large utf8)
+ *   binary types, BLOB       Z (large binary)
+ *
+ * SQL_ATTR_MAX_ROWS is honoured; the rows the server sends at once are
+ * set by SQL_ATTR_NUODB_FETCH_SIZE (see NuoODBCAttributes.h).
+ */
+SQLRETURN SQL_API NuoODBCFetchArrow(SQLHSTMT statement,
+                                    SQLULEN batchRows,
+                                    struct ArrowSchema* schema,
+                                    struct ArrowArray* batch);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+/*
+ * The NuoDB ODBC driver's own connection and statement attributes, set and
+ * read with SQLSetConnectAttr/SQLGetConnectAttr and
+ * SQLSetStmtAttr/SQLGetStmtAttr like the standard ones.  All are integers
+ * except SQL_ATTR_NUODB_MEMORY_USAGE.
+ */
+
+#include <sql.h>
+#include <sqlext.h>
+
+#ifndef SQL_DRIVER_CONN_ATTR_BASE
+# define SQL_DRIVER_CONN_ATTR_BASE 0x00004000
+#endif
+#ifndef SQL_DRIVER_STMT_ATTR_BASE
+# define SQL_DRIVER_STMT_ATTR_BASE 0x00004000
+#endif
+
+/*
+ * Connection attributes.
+ *
+ * SQL_ATTR_NUODB_MEMORY_LIMIT: the bytes the connection's statements may
+ * hold in driver buffers (parameters, SQLGetData values, rowsets,
+ * prefetched rows, static cursors), 0 for no limit.  A buffer that would
+ * go past it fails with HY001.  MemoryLimit in the connection string sets
+ * the same.
+ *
+ * SQL_ATTR_NUODB_MEMORY_USAGE: read only.  The bytes they hold, by use, as
+ * text: "parameters=n;getdata=n;rowsets=n;prefetch=n;cursors=n;".
+ */
+#define SQL_ATTR_NUODB_MEMORY_LIMIT (SQL_DRIVER_CONN_ATTR_BASE + 1)
+#define SQL_ATTR_NUODB_MEMORY_USAGE (SQL_DRIVER_CONN_ATTR_BASE + 2)
+
+/*
+ * Statement attributes.
+ *
+ * SQL_ATTR_NUODB_PREFETCH: rows per batch read ahead by a background
+ * thread while the application works on the rows it has, 0 to read rows
+ * as they're fetched.  Prefetch in the connection string sets the default.
+ *
+ * SQL_ATTR_NUODB_PARALLEL_FETCH: rowsets of at least this many rows are
+ * converted on several threads, 0 never.  ParallelFetch in the connection
+ * string sets the default.
+ *
+ * SQL_ATTR_NUODB_CURSOR_MEMORY: the bytes of rows a static cursor keeps in
+ * memory before it spills them to a temporary file.
+ *
+ * SQL_ATTR_NUODB_FETCH_SIZE: rows per network round trip, 0 for the rowset
+ * size, or SQL_NUODB_FETCH_ADAPTIVE to size it from the row width and round
+ * trip time of earlier results.  FetchSize in the connection string sets
+ * the default.
+ */
+#define SQL_ATTR_NUODB_PREFETCH (SQL_DRIVER_STMT_ATTR_BASE + 1)
+#define SQL_ATTR_NUODB_PARALLEL_FETCH (SQL_DRIVER_STMT_ATTR_BASE + 2)
+#define SQL_ATTR_NUODB_CURSOR_MEMORY (SQL_DRIVER_STMT_ATTR_BASE + 3)
+#define SQL_ATTR_NUODB_FETCH_SIZE (SQL_DRIVER_STMT_ATTR_BASE + 4)
+
+#define SQL_NUODB_FETCH_ADAPTIVE ((SQLULEN)-1)
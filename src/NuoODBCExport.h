@@ -0,0 +1,64 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+/*
+ * A NuoDB ODBC driver extension: the rest of a result set written to a
+ * file descriptor, as CSV or an Arrow IPC stream, by the driver itself
+ * rather than fetched and converted a cell at a time.
+ *
+ * Like NuoODBCFetchArrow (see NuoODBCArrow.h), the entry point is found
+ * in the driver library and takes the driver's own statement handle.
+ */
+
+#include <sql.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUOODBC_EXPORT_CSV          1
+#define NUOODBC_EXPORT_ARROW_IPC    2   /* the Arrow IPC streaming format */
+
+/* Which CSV values are quoted */
+#define NUOODBC_QUOTE_MINIMAL       0   /* those holding the delimiter, the quote or a line break, or read as NULL */
+#define NUOODBC_QUOTE_ALL           1   /* all but NULLs */
+#define NUOODBC_QUOTE_NONNUMERIC    2   /* all but NULLs and numbers */
+#define NUOODBC_QUOTE_NONE          3   /* none: values are written as they are */
+
+typedef struct NuoODBCExportOptions
+{
+    int         format;         /* NUOODBC_EXPORT_CSV or NUOODBC_EXPORT_ARROW_IPC */
+
+    /* CSV only; a zero field is given its default */
+    int         quoting;        /* NUOODBC_QUOTE_MINIMAL */
+    char        delimiter;      /* ',' */
+    char        quote;          /* '"', doubled within a value */
+    const char* nullToken;      /* "": an empty string is then quoted */
+    const char* lineEnd;        /* "\n" */
+    int         header;         /* whether the column names come first */
+
+    /* Arrow IPC only */
+    SQLULEN     batchRows;      /* rows per record batch, 65536 */
+} NuoODBCExportOptions;
+
+/*
+ * Write the rows that follow the cursor of a statement's forward-only
+ * result set to fd, in large writes, leaving the cursor after the last
+ * one; *rowCount, if rowCount isn't NULL, is set to the number written.
+ * Binary values are written to CSV as hex digits.  SQL_ATTR_MAX_ROWS is
+ * honoured.
+ */
+SQLRETURN SQL_API NuoODBCExport(SQLHSTMT statement,
+                                int fd,
+                                const NuoODBCExportOptions* options,
+                                SQLLEN* rowCount);
+
+#ifdef __cplusplus
+}
+#endif
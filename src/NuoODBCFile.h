@@ -0,0 +1,39 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+/*
+ * A NuoDB ODBC driver extension: columns and parameters bound to files,
+ * so that large values go between the database and a file without the
+ * application reading or writing them a piece at a time.
+ *
+ * A column bound with SQLBindCol, or read with SQLGetData, as
+ * SQL_C_NUODB_FILE has a buffer holding the NUL-terminated path of a file.
+ * Each fetch writes the whole value of the column to that file, replacing
+ * its contents, and sets the indicator to the number of bytes written.  A
+ * NULL value sets SQL_NULL_DATA and leaves the file alone.  BLOB and CLOB
+ * values are copied a chunk at a time; binary values other than BLOBs are
+ * written as they are, and the rest as text.
+ *
+ * A parameter bound with SQLBindParameter as SQL_C_NUODB_FILE points at a
+ * path, of the length given by StrLen_or_IndPtr or SQL_NTS.  The contents
+ * of the file are the value: bytes for the binary SQL types, UTF-8 text
+ * for the rest.  The file is mapped into memory rather than read.
+ *
+ * Driver managers only pass driver-specific C types on for applications
+ * that set SQL_ATTR_ODBC_VERSION to SQL_OV_ODBC3_80.
+ */
+
+#include <sql.h>
+#include <sqlext.h>
+
+#ifndef SQL_DRIVER_C_TYPE_BASE
+# define SQL_DRIVER_C_TYPE_BASE 0x4000
+#endif
+
+#define SQL_C_NUODB_FILE (SQL_DRIVER_C_TYPE_BASE + 1)
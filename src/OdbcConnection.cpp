@@ -83,6 +83,7 @@ static const int supportedFunctions[] = {
     SQL_API_SQLFETCH,
     SQL_API_SQLSETCONNECTATTR,
     SQL_API_SQLFETCHSCROLL,
+    SQL_API_SQLEXTENDEDFETCH,
     SQL_API_SQLSETCURSORNAME,
     SQL_API_SQLFREEHANDLE,
     SQL_API_SQLSETDESCFIELD,
@@ -318,6 +319,14 @@ RETCODE OdbcConnection::sqlBrowseConnect(SQLCHAR* inString,
             driver = trim(value, "{}");
         } else if (!strcasecmp(name, "SCHEMA")) {
             schema = value;
+        } else if (!strcasecmp(name, "PREFETCH")) {
+            prefetch = value;
+        } else if (!strcasecmp(name, "PARALLELFETCH")) {
+            parallelFetch = value;
+        } else if (!strcasecmp(name, "FETCHSIZE")) {
+            fetchSize = value;
+        } else if (!strcasecmp(name, "MEMORYLIMIT")) {
+            memoryLimit = value;
         } else if (!strcasecmp(name, "ODBC")) {} else {
             std::ostringstream text;
             text << "Invalid connection string attribute: " << name;
@@ -362,6 +371,18 @@ RETCODE OdbcConnection::sqlBrowseConnect(SQLCHAR* inString,
         r = appendAttribute("UIC", account.c_str(), r, r == returnString);
         r = appendAttribute("PWD", password.c_str(), r, r == returnString);
         r = appendAttribute("SCHEMA", schema.c_str(), r, r == returnString);
+        if (!prefetch.empty()) {
+            r = appendAttribute("PREFETCH", prefetch.c_str(), r, r == returnString);
+        }
+        if (!parallelFetch.empty()) {
+            r = appendAttribute("PARALLELFETCH", parallelFetch.c_str(), r, r == returnString);
+        }
+        if (!fetchSize.empty()) {
+            r = appendAttribute("FETCHSIZE", fetchSize.c_str(), r, r == returnString);
+        }
+        if (!memoryLimit.empty()) {
+            r = appendAttribute("MEMORYLIMIT", memoryLimit.c_str(), r, r == returnString);
+        }
         r = appendAttribute("DRIVER", driver.c_str(), r, r == returnString); // last in the string to make Excel happier
 
         if (setString((UCHAR*)returnString, r - returnString, outString, outStringLen, outStringLenPtr)) {
@@ -430,6 +451,10 @@ RETCODE OdbcConnection::sqlSetConnectAttr(SQLINTEGER arg1, SQLPOINTER arg2, SQLI
                 }
                 break;
             }
+
+            case SQL_ATTR_NUODB_MEMORY_LIMIT:
+                memory.setLimit((size_t)(SQLULEN)arg2);
+                break;
         }
     } catch (SQLException& e) {
         postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(e.getSqlcode()), e);
@@ -499,6 +524,14 @@ RETCODE OdbcConnection::sqlDriverConnect(SQLHWND hWnd, const SQLCHAR* connectStr
             driver = trim(value, "{}");
         } else if (!strcasecmp(name, "SCHEMA")) {
             schema = value;
+        } else if (!strcasecmp(name, "PREFETCH")) {
+            prefetch = value;
+        } else if (!strcasecmp(name, "PARALLELFETCH")) {
+            parallelFetch = value;
+        } else if (!strcasecmp(name, "FETCHSIZE")) {
+            fetchSize = value;
+        } else if (!strcasecmp(name, "MEMORYLIMIT")) {
+            memoryLimit = value;
         } else if (!strcasecmp(name, "ODBC")) {} else {
             std::ostringstream text;
             text << "Invalid connection string attribute: " << name;
@@ -514,6 +547,18 @@ RETCODE OdbcConnection::sqlDriverConnect(SQLHWND hWnd, const SQLCHAR* connectStr
     r = appendAttribute("UIC", account.c_str(), r, r == returnString);
     r = appendAttribute("PWD", password.c_str(), r, r == returnString);
     r = appendAttribute("SCHEMA", schema.c_str(), r, r == returnString);
+    if (!prefetch.empty()) {
+        r = appendAttribute("PREFETCH", prefetch.c_str(), r, r == returnString);
+    }
+    if (!parallelFetch.empty()) {
+        r = appendAttribute("PARALLELFETCH", parallelFetch.c_str(), r, r == returnString);
+    }
+    if (!fetchSize.empty()) {
+        r = appendAttribute("FETCHSIZE", fetchSize.c_str(), r, r == returnString);
+    }
+    if (!memoryLimit.empty()) {
+        r = appendAttribute("MEMORYLIMIT", memoryLimit.c_str(), r, r == returnString);
+    }
     r = appendAttribute("DRIVER", driver.c_str(), r, r == returnString); // last in the string to make Excel happier
 
     if (setString((UCHAR*)returnString, r - returnString, outConnectBuffer, connectBufferLength, outStringLength)) {
@@ -631,16 +676,25 @@ RETCODE OdbcConnection::sqlGetInfo(SQLUSMALLINT type, SQLPOINTER ptr, SQLSMALLIN
                 break;
 
             case SQL_KEYSET_CURSOR_ATTRIBUTES1:
+                value = SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE | SQL_CA1_LOCK_NO_CHANGE | SQL_CA1_POS_POSITION;
+                break;
+
             case SQL_KEYSET_CURSOR_ATTRIBUTES2:
-                value = 0;
+                value = SQL_CA2_READ_ONLY_CONCURRENCY | SQL_CA2_SENSITIVITY_DELETIONS | SQL_CA2_SENSITIVITY_UPDATES | SQL_CA2_MAX_ROWS_SELECT;
                 break;
 
             case SQL_STATIC_CURSOR_ATTRIBUTES1:
+                value = SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE | SQL_CA1_LOCK_NO_CHANGE | SQL_CA1_POS_POSITION;
+                break;
+
             case SQL_STATIC_CURSOR_ATTRIBUTES2:
-                value = 0;
+                value = SQL_CA2_READ_ONLY_CONCURRENCY | SQL_CA2_MAX_ROWS_SELECT;
                 break;
 
             case SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1:
+                value = SQL_CA1_NEXT | SQL_CA1_POS_POSITION;
+                break;
+
             case SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES2:
                 value = 0;
                 break;
@@ -766,11 +820,11 @@ RETCODE OdbcConnection::sqlGetInfo(SQLUSMALLINT type, SQLPOINTER ptr, SQLSMALLIN
                 break;
 
             case SQL_POS_OPERATIONS:
-                value = 0; // aka not implemented
+                value = SQL_POS_POSITION;
                 break;
 
             case SQL_GETDATA_EXTENSIONS:
-                value = 0; // aka not implemented
+                value = SQL_GD_ANY_COLUMN | SQL_GD_ANY_ORDER | SQL_GD_BLOCK | SQL_GD_BOUND;
                 break;
 
             case SQL_ODBC_VER:
@@ -822,7 +876,7 @@ RETCODE OdbcConnection::sqlGetInfo(SQLUSMALLINT type, SQLPOINTER ptr, SQLSMALLIN
                 break;
 
             case SQL_SCROLL_OPTIONS:
-                value = SQL_SO_FORWARD_ONLY;
+                value = SQL_SO_FORWARD_ONLY | SQL_SO_KEYSET_DRIVEN | SQL_SO_STATIC;
                 break;
 
             case SQL_DEFAULT_TXN_ISOLATION:
@@ -1084,6 +1138,9 @@ RETCODE OdbcConnection::connect()
     }
 
     connection->setTransactionIsolation(transactionIsolation);
+    if (!memoryLimit.empty()) {
+        memory.setLimit((size_t)strtoull(memoryLimit.c_str(), NULL, 10));
+    }
     connected = true;
 
     return SQL_SUCCESS;
@@ -1161,6 +1218,22 @@ void OdbcConnection::expandConnectParameters()
         if (schema.empty()) {
             schema = readAttribute(SETUP_SCHEMA);
         }
+
+        if (prefetch.empty()) {
+            prefetch = readAttribute(SETUP_PREFETCH);
+        }
+
+        if (parallelFetch.empty()) {
+            parallelFetch = readAttribute(SETUP_PARALLEL_FETCH);
+        }
+
+        if (fetchSize.empty()) {
+            fetchSize = readAttribute(SETUP_FETCH_SIZE);
+        }
+
+        if (memoryLimit.empty()) {
+            memoryLimit = readAttribute(SETUP_MEMORY_LIMIT);
+        }
     }
 }
 
@@ -1189,6 +1262,7 @@ RETCODE OdbcConnection::sqlGetConnectAttr(SQLINTEGER attribute, SQLPOINTER ptr,
     long        value;
     const char* string = NULL;
     bool        stringValue = false; // flag for saying that this is a string value
+    std::string usage;
 
     switch (attribute) {
         case SQL_ATTR_ASYNC_ENABLE:
@@ -1207,6 +1281,21 @@ RETCODE OdbcConnection::sqlGetConnectAttr(SQLINTEGER attribute, SQLPOINTER ptr,
             value = (autoCommit) ? SQL_AUTOCOMMIT_ON : SQL_AUTOCOMMIT_OFF;
             break;
 
+        case SQL_ATTR_NUODB_MEMORY_LIMIT:
+            if (ptr) {
+                *(SQLULEN*)ptr = memory.getLimit();
+            }
+            if (lengthPtr) {
+                *lengthPtr = sizeof(SQLULEN);
+            }
+            return sqlSuccess();
+
+        case SQL_ATTR_NUODB_MEMORY_USAGE:
+            usage = memory.describe();
+            string = usage.c_str();
+            stringValue = true;
+            break;
+
         case SQL_LOGIN_TIMEOUT: //   103
         case SQL_OPT_TRACE: //   104
         case SQL_OPT_TRACEFILE: //   105
@@ -1271,6 +1360,11 @@ CallableStatement* OdbcConnection::prepareCall(const char* sql)
     return connection->prepareCall(sql);
 }
 
+SQLULEN OdbcConnection::getFetchSize() const
+{
+    return strcasecmp(fetchSize.c_str(), "ADAPTIVE") ? (SQLULEN)atoi(fetchSize.c_str()) : SQL_NUODB_FETCH_ADAPTIVE;
+}
+
 PreparedStatement* OdbcConnection::prepareStatement(const char* sql)
 {
     return connection->prepareStatement(sql, NuoDB::RETURN_GENERATED_KEYS);
@@ -9,8 +9,13 @@
 
 #include "OdbcBase.h"
 
+#include <stdlib.h>
 #include <string>
 
+#include "ClientGate.h"
+#include "DateTime.h"
+#include "MemoryAccount.h"
+#include "NuoODBCAttributes.h"
 #include "OdbcDesc.h"
 
 namespace NuoDB {
@@ -60,6 +65,13 @@ public:
     virtual OdbcObjectType      getType();
     NuoDB::CallableStatement*   prepareCall(const char* sql);
     NuoDB::PreparedStatement*   prepareStatement(const char* sql);
+    TimeZoneCache*              getTimeZoneCache() { return &timeZone; }
+    int                         getPrefetchRows() const { return atoi(prefetch.c_str()); }
+    int                         getParallelFetchRows() const { return atoi(parallelFetch.c_str()); }
+    SQLULEN                     getFetchSize() const;
+    OdbcEnv*                    getEnv() const { return env; }
+    MemoryAccount*              getMemoryAccount() { return &memory; }
+    ClientGate*                 getClientGate() { return &clientGate; }
 
 private:
     int32_t getSupportedTransactionIsolationBitmask();
@@ -87,8 +99,15 @@ private:
     std::string         account;
     std::string         password;
     std::string         schema;
+    std::string         prefetch;   // rows per batch read ahead by a background thread; none if empty or 0
+    std::string         parallelFetch;  // rowsets of at least this many rows are converted by the env's workers; never if empty or 0
+    std::string         fetchSize;  // rows per round trip, ADAPTIVE, or the rowset size if empty or 0
+    std::string         memoryLimit;    // bytes of driver buffers, see MemoryAccount; no limit if empty or 0
     std::string         driver;
     bool                asyncEnabled;
     bool                autoCommit;
     int                 transactionIsolation;
+    TimeZoneCache       timeZone;
+    MemoryAccount       memory;
+    ClientGate          clientGate;     // the client connection, shared with prefetch threads
 };
@@ -11,7 +11,9 @@
 
 #include "OdbcBase.h"
 #include "OdbcConnection.h"
+#include "OdbcStatement.h"
 #include "DescRecord.h"
+#include "Numeric.h"
 
 #include "NuoRemote/CallableStatement.h"
 #include "NuoRemote/Connection.h"
@@ -64,6 +66,31 @@ RETCODE OdbcDesc::sqlSetDescField(int recNumber, int fieldId, SQLPOINTER value,
             }
             break;
 
+        case SQL_DESC_TYPE:
+        case SQL_DESC_CONCISE_TYPE:
+            if (record) {
+                // setting the type puts the precision and scale back to
+                // their defaults
+                record->type = (int)(SQLLEN)value;
+                record->precisionSet = false;
+                record->scaleSet = false;
+            }
+            break;
+
+        case SQL_DESC_PRECISION:
+            if (record) {
+                record->precision = (int)(SQLLEN)value;
+                record->precisionSet = true;
+            }
+            break;
+
+        case SQL_DESC_SCALE:
+            if (record) {
+                record->scale = (int)(SQLLEN)value;
+                record->scaleSet = true;
+            }
+            break;
+
         /***
         case SQL_DESC_COUNT                  1001
         case SQL_DESC_TYPE                   1002
@@ -84,16 +111,33 @@ RETCODE OdbcDesc::sqlSetDescField(int recNumber, int fieldId, SQLPOINTER value,
             return sqlReturn(SQL_ERROR, "HY091", "Invalid descriptor field identifier");
     }
 
+    // the statement's fetch plan was compiled from the ARD as it was
+    if (statement && descType == odtApplicationRow) {
+        statement->invalidateFetchPlan();
+    }
+
     return sqlSuccess();
 }
 
+bool OdbcDesc::getPrecisionAndScale(int number, int* precision, int* scale) const
+{
+    DescRecord* record = (number < recordSlots) ? records[number] : nullptr;
+    if (!record || (!record->precisionSet && !record->scaleSet)) {
+        return false;
+    }
+
+    *precision = record->precisionSet ? record->precision : NUMERIC_MAX_PRECISION;
+    *scale = record->scaleSet ? record->scale : 0;
+    return true;
+}
+
 DescRecord* OdbcDesc::getDescRecord(int number)
 {
     if (number >= recordSlots) {
         int             oldSlots = recordSlots;
         DescRecord**    oldRecords = records;
         recordSlots = number + 20;
-        records = new DescRecord*[recordSlots];
+        records = new DescRecord*[recordSlots]();
         if (oldSlots) {
             memcpy(records, oldRecords, sizeof(DescRecord*) * oldSlots);
             delete[] oldRecords;
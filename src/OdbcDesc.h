@@ -19,6 +19,7 @@ enum OdbcDescType
 };
 
 class OdbcConnection;
+class OdbcStatement;
 class DescRecord;
 
 class OdbcDesc : public OdbcObject
@@ -33,9 +34,14 @@ public:
     virtual OdbcObjectType getType() { return odbcTypeDescriptor; }
 
     DescRecord* getDescRecord(int number);
+
+    // The SQL_DESC_PRECISION and SQL_DESC_SCALE of a record, if the
+    // application has set either; the other then has its default.
+    bool getPrecisionAndScale(int number, int* precision, int* scale) const;
     RETCODE sqlSetDescField(int recNumber, int fieldId, SQLPOINTER value, int length);
 
     OdbcConnection* connection;
+    OdbcStatement*  statement = nullptr;    // an implicit descriptor's owner
     DescRecord**    records = nullptr;
     int             recordSlots = 0;
     OdbcDescType    descType;
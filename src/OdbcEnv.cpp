@@ -8,6 +8,8 @@
 #include "OdbcEnv.h"
 
 #include <stdlib.h>
+#include <algorithm>
+#include <thread>
 
 #include "OdbcBase.h"
 #include "OdbcConnection.h"
@@ -51,6 +53,7 @@ RETCODE OdbcEnv::sqlEndTran(int operation)
 
     for (OdbcConnection* connection = connections; connection;
          connection = (OdbcConnection*)connection->next) {
+        ClientGate::Use use(connection->getClientGate());
         RETCODE retcode = connection->sqlEndTran(operation);
         if (retcode != SQL_SUCCESS) {
             ret = retcode;
@@ -70,6 +73,19 @@ void OdbcEnv::connectionClosed(OdbcConnection* connection)
     }
 }
 
+// Leave a core or so to the threads reading rows.
+#define MAX_WORKER_THREADS 7
+
+WorkerPool* OdbcEnv::getWorkerPool()
+{
+    std::lock_guard<std::mutex> lock(workersMutex);
+    if (!workers) {
+        int cores = (int)std::thread::hardware_concurrency();
+        workers.reset(new WorkerPool(std::min(std::max(cores - 1, 1), MAX_WORKER_THREADS)));
+    }
+    return workers.get();
+}
+
 RETCODE OdbcEnv::sqlSetEnvAttr(SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER length)
 {
     clearErrors();
@@ -7,8 +7,12 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "OdbcBase.h"
 #include "OdbcObject.h"
+#include "WorkerPool.h"
 
 class OdbcConnection;
 
@@ -26,6 +30,14 @@ public:
     RETCODE sqlEndTran(int operation);
     void    connectionClosed(OdbcConnection* connection);
 
+    // The threads that convert large rowsets, started the first time
+    // they're needed.
+    WorkerPool* getWorkerPool();
+
     OdbcConnection* connections = nullptr;
     const char*     odbcIniFileName;
+
+private:
+    std::mutex                  workersMutex;
+    std::unique_ptr<WorkerPool> workers;
 };
@@ -82,6 +82,14 @@ RETCODE OdbcError::sqlGetDiagField(SQLSMALLINT diagId, SQLPOINTER ptr, SQLSMALLI
             string = sqlState.c_str();
             break;
 
+        case SQL_DIAG_ROW_NUMBER:
+            *(SQLLEN*)ptr = rowNumber;
+            return SQL_SUCCESS;
+
+        case SQL_DIAG_COLUMN_NUMBER:
+            value = columnNumber;
+            break;
+
         default:
             return SQL_ERROR;
     }
@@ -24,4 +24,9 @@ public:
     std::string sqlState;
     std::string msg;
     int nativeCode;
+
+    // where in a rowset the error arose, for SQL_DIAG_ROW_NUMBER and
+    // SQL_DIAG_COLUMN_NUMBER
+    SQLLEN      rowNumber = SQL_NO_ROW_NUMBER;
+    SQLINTEGER  columnNumber = SQL_NO_COLUMN_NUMBER;
 };
@@ -174,6 +174,11 @@ RETCODE OdbcObject::sqlError(SQLCHAR* stateBuffer, SQLINTEGER* nativeCode, SQLCH
 void OdbcObject::postError(OdbcError* error)
 {
     infoPosted = true;
+    if (diagRow != SQL_NO_ROW_NUMBER && error->rowNumber == SQL_NO_ROW_NUMBER) {
+        error->rowNumber = diagRow;
+        error->columnNumber = diagColumn;
+    }
+
     OdbcError** ptr;
 
     for (ptr = &errors; *ptr; ptr = &(*ptr)->next) {}
@@ -41,6 +41,11 @@ public:
     void postError(const char* state, std::string msg);
     void postError(const char* sqlState, NuoDB::SQLException& exception);
     void clearErrors();
+
+    // Errors posted until the position is cleared are placed at this row
+    // of the rowset and column, both counted from 1.
+    void setDiagPosition(SQLLEN row, SQLINTEGER column) { diagRow = row; diagColumn = column; }
+    void clearDiagPosition() { diagRow = SQL_NO_ROW_NUMBER; diagColumn = SQL_NO_COLUMN_NUMBER; }
     bool appendString(const char* string, SQLSMALLINT stringLength, SQLCHAR* target, SQLSMALLINT targetSize, SQLSMALLINT* targetLength);
     bool setString(const char* string, SQLCHAR* target, SQLSMALLINT targetSize, SQLSMALLINT* targetLength);
     bool setString(const SQLCHAR* string, SQLLEN stringLength, SQLCHAR* target, SQLSMALLINT targetSize, SQLSMALLINT* targetLength);
@@ -56,4 +61,8 @@ public:
     OdbcError*  errors = nullptr;
     OdbcObject* next = nullptr;
     bool infoPosted = false;
+
+private:
+    SQLLEN     diagRow = SQL_NO_ROW_NUMBER;
+    SQLINTEGER diagColumn = SQL_NO_COLUMN_NUMBER;
 };
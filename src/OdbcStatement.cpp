@@ -5,33 +5,41 @@
  * See the LICENSE file provided with this software.
  */
 
-// std::wstring_convert is deprecated in C++17, but there's no standard
-// replacement yet, so keep using it.  An alternative would be to switch
-// to ICU or similar, but...
-#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
-
+#include <errno.h>
+#include <limits.h>
 #include <time.h>
 #include <string.h>
 #include <stdio.h>
 #include <string>
-
-// See issue above related to C++17 deprecation.
-#include <locale>
-#include <codecvt>
 #include <algorithm>
+#include <chrono>
 
 #include "OdbcStatement.h"
 
 #include "OdbcBase.h"
+#include "ArrowExport.h"
+#include "DateTime.h"
 #include "GetDataTypeFilter.h"
+#include "HexCodec.h"
+#include "KeysetResultSet.h"
+#include "LobFile.h"
+#include "Numeric.h"
 #include "OdbcConnection.h"
+#include "OdbcEnv.h"
 #include "OdbcError.h"
 #include "OdbcTrace.h"
 #include "OdbcTypeMapper.h"
+#include "PrefetchResultSet.h"
+#include "ResultExport.h"
 #include "ResultSetMapper.h"
+#include "StaticResultSet.h"
+#include "TextFormat.h"
+#include "Transcoder.h"
 
 #include "NuoRemote/Blob.h"
+#include "NuoRemote/Bytes.h"
 #include "NuoRemote/CallableStatement.h"
+#include "NuoRemote/Clob.h"
 #include "NuoRemote/DateClass.h"
 #include "NuoRemote/DatabaseMetaData.h"
 #include "NuoRemote/ParameterMetaData.h"
@@ -44,20 +52,7 @@
 
 using namespace NuoDB;
 
-/* Default to the POSIX API; make Windows groks it. */
-#ifdef _WIN32
-# define localtime_r(_t, _r) localtime_s(_r, _t)
-#endif
-
-#ifdef _WIN32
-# define widechar_t wchar_t
-# define widestring std::wstring
-#else
-# define widechar_t char16_t
-# define widestring std::u16string
-#endif
-
-#define RESULTS(fn)         (resultSet ? resultSet->fn : callableStatement->fn)
+#define RESULTS(fn)         (results ? results->fn : callableStatement->fn)
 #define SKIP_WHITE(p)       while (ODBC_STATEMENT::charTable[(int)*(p)] == WHITE) ++(p)
 
 #define PUNCT   1
@@ -103,6 +98,20 @@ int init()
     return 0;
 }
 
+// About the bytes a row of metaData takes on the wire, for sizing fetches:
+// a long value is counted as far as a few KB of it.
+static size_t getRowWidth(ResultSetMetaData* metaData)
+{
+    size_t width = 0;
+    int    count = metaData->getColumnCount();
+
+    for (int n = 1; n <= count; ++n) {
+        width += 4 + (size_t)std::min(std::max(metaData->getColumnDisplaySize(n), 0), 4096);
+    }
+
+    return width;
+}
+
 } // namespace ODBC_STATEMENT
 
 //////////////////////////////////////////////////////////////////////
@@ -114,8 +123,15 @@ OdbcStatement::OdbcStatement(OdbcConnection* connect)
       applicationRowDescriptor(connect->allocDescriptor(odtApplicationRow)),
       applicationParamDescriptor(connect->allocDescriptor(odtApplicationParameter)),
       implementationRowDescriptor(connect->allocDescriptor(odtImplementationRow)),
-      implementationParamDescriptor(connect->allocDescriptor(odtImplementationParameter))
+      implementationParamDescriptor(connect->allocDescriptor(odtImplementationParameter)),
+      cursorMemory(DEFAULT_CURSOR_MEMORY),
+      fetchSize(connect->getFetchSize()),
+      prefetchRows(connect->getPrefetchRows()),
+      parallelFetchRows(connect->getParallelFetchRows())
 {
+    applicationRowDescriptor->statement = this;
+    parameters.setAccount(connect->getMemoryAccount(), MemoryUse::Parameters);
+    getDataBindings.setAccount(connect->getMemoryAccount(), MemoryUse::GetData);
 }
 
 OdbcStatement::~OdbcStatement()
@@ -133,6 +149,11 @@ OdbcObjectType OdbcStatement::getType()
     return odbcTypeStatement;
 }
 
+ClientGate* OdbcStatement::getClientGate()
+{
+    return connection->getClientGate();
+}
+
 RETCODE OdbcStatement::sqlTables(SQLCHAR* catalog, SQLSMALLINT catLength,
                                  SQLCHAR* schema, SQLSMALLINT schemaLength,
                                  SQLCHAR* table, SQLSMALLINT tableLength,
@@ -213,6 +234,7 @@ void OdbcStatement::releaseStatement()
     callableStatement = NULL;
     metaData = nullptr;
     numberColumns = 0;
+    columnSizes.invalidate();
 
     if (statement) {
         statement->close();
@@ -222,16 +244,68 @@ void OdbcStatement::releaseStatement()
 
 void OdbcStatement::releaseResultSet()
 {
+    if (resultSet && metaData && fetchSize == SQL_NUODB_FETCH_ADAPTIVE && !scroller) {
+        adaptiveFetch.finish(ODBC_STATEMENT::getRowWidth(metaData));
+    }
     if (resultSet) {
+        // A cursor that wasn't read to its end is closed now rather than
+        // with the statement, so that the server's cursor, and the rows
+        // the client has buffered for it, don't outlive it.
+        if (!eof || scroller) {
+            try {
+                resultSet->close();
+            } catch (SQLException& exception) {
+                TRACE(formatString("closing the cursor failed: %s", exception.getText()).c_str());
+            }
+        }
         resultSet = NULL;
         metaData = NULL;
     }
+    if (scroller) {
+        scroller->release();
+        scroller = nullptr;
+    }
+    if (prefetcher) {
+        // stops the producer before the statement moves its results on
+        prefetcher->release();
+        prefetcher = nullptr;
+    }
+    if (ownedResults) {
+        ownedResults->release();
+        ownedResults = nullptr;
+    }
+    rowsetStart = 0;
+    rowsetSize = 0;
+    fetchPlan.invalidate();
+    columnSizes.invalidate();
     getDataBindings.release();
+    rowset.close();
+    rowPosition = 0;
 }
 
-void OdbcStatement::setResultSet(ResultSet* results)
+// Make results the statement's cursor.  With owned, the statement holds
+// the only reference to them.
+void OdbcStatement::setResultSet(ResultSet* results, bool owned)
 {
     releaseResultSet();
+    if (owned) {
+        ownedResults = results;
+    }
+
+    if (cursorType == SQL_CURSOR_KEYSET_DRIVEN) {
+        scroller = KeysetResultSet::open(connection, results, cursorMemory, keysetSize, maxRowsPerSelect);
+        if (!scroller) {
+            cursorType = SQL_CURSOR_STATIC;
+            postError("01S02", "Option value changed: the result set isn't over a table with a primary key, SQL_CURSOR_STATIC is used instead");
+        }
+    }
+    if (cursorType == SQL_CURSOR_STATIC) {
+        scroller = new StaticResultSet(results, connection->getTimeZoneCache(), cursorMemory, maxRowsPerSelect,
+                                       connection->getMemoryAccount());
+    }
+    if (scroller) {
+        results = scroller;
+    }
 
     resultSet = results;
     metaData = resultSet->getMetaData();
@@ -283,6 +357,7 @@ RETCODE OdbcStatement::sqlBindCol(SQLUSMALLINT column, SQLSMALLINT targetType, S
         case SQL_TYPE_TIME:
         case SQL_TYPE_TIMESTAMP:
         case SQL_LONGVARCHAR:
+        case SQL_C_NUODB_FILE:
         case SQL_C_DEFAULT:
             break;
 
@@ -298,11 +373,323 @@ RETCODE OdbcStatement::sqlBindCol(SQLUSMALLINT column, SQLSMALLINT targetType, S
     binding->pointer = targetValuePtr;
     binding->bufferLength = bufferLength;
     binding->indicatorPointer = indPtr;
+    fetchPlan.invalidate();
 
     return sqlSuccess();
 }
 
 RETCODE OdbcStatement::sqlFetch()
+{
+    return scroller ? sqlFetchScroll(SQL_FETCH_NEXT, 0) : fetchForward();
+}
+
+// The next rowset of a forward-only cursor, timed for an adaptive fetch
+// size.
+RETCODE OdbcStatement::fetchForward()
+{
+    if (fetchSize != SQL_NUODB_FETCH_ADAPTIVE) {
+        return fetchCanceled(fetchRowset());
+    }
+
+    auto    start = std::chrono::steady_clock::now();
+    RETCODE ret = fetchRowset();
+    adaptiveFetch.record(rowCountPerFetch, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    return fetchCanceled(ret);
+}
+
+// SQLCancel was called while the rowset was fetched: the rows fetched are
+// dropped with the cursor.  A fetch that found it canceled at the start has
+// already done so.
+RETCODE OdbcStatement::fetchCanceled(RETCODE ret)
+{
+    if (!cancel || !resultSet) {
+        return ret;
+    }
+
+    releaseResultSet();
+    return sqlReturn(SQL_ERROR, "S1008", "Operation canceled");
+}
+
+// Where the rowset of a static cursor starts, by the rules in the ODBC
+// reference for SQLFetchScroll.  The rowset is either
+//  - before the first row (0),
+//  - at the row returned, where 'warn' means 01S06: a rowset would have
+//    started before the first row, so the first rowset is returned instead, or
+//  - after the last row (past the end).
+// Working this out reads every row of the base for some fetches.
+RETCODE OdbcStatement::sqlFetchScroll(SQLSMALLINT orientation, SQLLEN offset)
+{
+    if (!scroller) {
+        if (orientation == SQL_FETCH_NEXT) {
+            return fetchForward();
+        }
+        return sqlReturn(SQL_ERROR, "HY106", "Invalid fetch type.  Only SQL_FETCH_NEXT supported on a forward-only cursor");
+    }
+
+    clearErrors();
+
+    SQLLEN size = (SQLLEN)rowArraySize;
+    SQLLEN start = (SQLLEN)rowsetStart;
+    bool   afterEnd = start > (SQLLEN)scroller->getRowsRead();
+    SQLLEN target = 0;
+    bool   warn = false;
+
+    try {
+        switch (orientation) {
+            case SQL_FETCH_NEXT:
+                target = start == 0 ? 1 : afterEnd ? start : start + (SQLLEN)rowsetSize;
+                break;
+
+            case SQL_FETCH_PRIOR:
+                if (afterEnd) {
+                    target = std::max<SQLLEN>(1, (SQLLEN)scroller->getRowCount() - size + 1);
+                } else if (start > 1 && start <= size) {
+                    target = 1;
+                    warn = true;
+                } else if (start > 1) {
+                    target = start - size;
+                }
+                break;
+
+            case SQL_FETCH_RELATIVE:
+                if (start == 0) {
+                    target = offset > 0 ? offset : 0;
+                    break;
+                }
+                if (!afterEnd) {
+                    target = start + offset;
+                    if (target < 1) {
+                        warn = start > 1 && offset >= -size;
+                        target = warn ? 1 : 0;
+                    }
+                    break;
+                }
+                if (offset >= 0) {
+                    target = start;
+                    break;
+                }
+                // back from after the end, as it would be from the end
+                // fall through
+
+            case SQL_FETCH_ABSOLUTE:
+                if (offset < 0) {
+                    SQLLEN rows = (SQLLEN)scroller->getRowCount();
+                    if (-offset <= rows) {
+                        target = rows + offset + 1;
+                    } else if (-offset <= size) {
+                        target = 1;
+                        warn = true;
+                    }
+                } else {
+                    target = offset;
+                }
+                break;
+
+            case SQL_FETCH_FIRST:
+                target = 1;
+                break;
+
+            case SQL_FETCH_LAST:
+                target = std::max<SQLLEN>(1, (SQLLEN)scroller->getRowCount() - size + 1);
+                break;
+
+            case SQL_FETCH_BOOKMARK:
+                return sqlReturn(SQL_ERROR, "HYC00", "Optional feature not implemented: bookmarks");
+
+            default:
+                return sqlReturn(SQL_ERROR, "HY106", "Fetch type out of range");
+        }
+
+        // the fetch moves on from the row before the rowset
+        scroller->setRowsetSize(rowArraySize);
+        scroller->seek(target > 0 ? target - 1 : 0);
+    } catch (SQLException& exception) {
+        postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+        return SQL_ERROR;
+    }
+
+    eof = target <= 0;
+    rowCountPerSelect = target > 0 ? target - 1 : 0;
+
+    RETCODE ret = fetchRowset();
+
+    rowsetSize = rowArraySize;
+    if (target <= 0) {
+        rowsetStart = 0;
+    } else if (rowCountPerFetch == 0) {
+        rowsetStart = scroller->getRowsRead() + 1;
+    } else {
+        rowsetStart = target;
+    }
+
+    if (rowStatusPtr && ret != SQL_ERROR) {
+        for (SQLULEN n = 0; n < rowCountPerFetch; n++) {
+            if (scroller->isDeleted(rowsetStart + n)) {
+                rowStatusPtr[n] = SQL_ROW_DELETED;
+            }
+        }
+    }
+
+    if (warn && ret == SQL_SUCCESS) {
+        postError("01S06", "Attempt to fetch before the result set returned the first rowset");
+        ret = SQL_SUCCESS_WITH_INFO;
+    }
+
+    return fetchCanceled(ret);
+}
+
+// SQLExtendedFetch is SQLFetchScroll with the row count and row status
+// array passed in rather than set as statement attributes.
+RETCODE OdbcStatement::sqlExtendedFetch(SQLUSMALLINT orientation, SQLLEN offset, SQLULEN* rowCountPtr, SQLUSMALLINT* rowStatusArray)
+{
+    SQLULEN*      fetchedPtr = rowCountPerFetchPtr;
+    SQLUSMALLINT* statusPtr = rowStatusPtr;
+
+    rowCountPerFetchPtr = rowCountPtr;
+    rowStatusPtr = rowStatusArray;
+    RETCODE ret = sqlFetchScroll(orientation, offset);
+    rowCountPerFetchPtr = fetchedPtr;
+    rowStatusPtr = statusPtr;
+
+    return ret;
+}
+
+// NuoODBCFetchArrow: the rows that follow the cursor as an Arrow batch,
+// read straight from the result set.  No rowset is left for SQLGetData.
+RETCODE OdbcStatement::sqlFetchArrow(SQLULEN batchRows, ArrowSchema* schema, ArrowArray* batch)
+{
+    clearErrors();
+
+    if (!resultSet) {
+        return sqlReturn(SQL_ERROR, "24000", "Invalid cursor state");
+    }
+    if (scroller) {
+        return sqlReturn(SQL_ERROR, "HY106", "Arrow batches are only read from a forward-only cursor");
+    }
+    if (!batch) {
+        return sqlReturn(SQL_ERROR, "HY009", "Invalid use of null pointer");
+    }
+    if (batchRows == 0) {
+        return sqlReturn(SQL_ERROR, "HY090", "Invalid string or buffer length");
+    }
+    if (cancel) {
+        releaseResultSet();
+        return sqlReturn(SQL_ERROR, "S1008", "Operation canceled");
+    }
+
+    rowCountPerFetch = 0;
+    rowPosition = 0;
+    rowset.close();
+    getDataBindings.reset();
+
+    if (!eof && maxRowsPerSelect > 0) {
+        if (rowCountPerSelect >= maxRowsPerSelect) {
+            closeAtMaxRows();
+        } else {
+            batchRows = std::min(batchRows, maxRowsPerSelect - rowCountPerSelect);
+        }
+    }
+    if (eof) {
+        return SQL_NO_DATA;
+    }
+
+    size_t rows = 0;
+    try {
+        std::vector<ArrowExport::ArrowColumn> columns = ArrowExport::describe(metaData);
+        rows = ArrowExport::exportBatch(resultSet, columns, connection->getTimeZoneCache(), batchRows, batch);
+        if (rows > 0 && schema) {
+            ArrowExport::exportSchema(columns, schema);
+        }
+    } catch (SQLException& exception) {
+        postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+        return SQL_ERROR;
+    }
+
+    rowCountPerSelect += rows;
+    if (rows < batchRows) {
+        eof = true;
+    }
+
+    return rows > 0 ? sqlSuccess() : SQL_NO_DATA;
+}
+
+// NuoODBCExport: the rows that follow the cursor written to fd, read
+// straight from the result set.  A result set already read to its end (or
+// to SQL_ATTR_MAX_ROWS) still gets a header or an Arrow schema.
+RETCODE OdbcStatement::sqlExport(int fd, const NuoODBCExportOptions* options, SQLLEN* rowCount)
+{
+    clearErrors();
+
+    if (rowCount) {
+        *rowCount = 0;
+    }
+    if (!resultSet) {
+        return sqlReturn(SQL_ERROR, "24000", "Invalid cursor state");
+    }
+    if (scroller) {
+        return sqlReturn(SQL_ERROR, "HY106", "Rows are only exported from a forward-only cursor");
+    }
+    if (!options) {
+        return sqlReturn(SQL_ERROR, "HY009", "Invalid use of null pointer");
+    }
+    if ((options->format != NUOODBC_EXPORT_CSV && options->format != NUOODBC_EXPORT_ARROW_IPC)
+        || options->quoting < NUOODBC_QUOTE_MINIMAL || options->quoting > NUOODBC_QUOTE_NONE) {
+        return sqlReturn(SQL_ERROR, "HY024", "Invalid attribute value");
+    }
+    if (cancel) {
+        releaseResultSet();
+        return sqlReturn(SQL_ERROR, "S1008", "Operation canceled");
+    }
+
+    rowCountPerFetch = 0;
+    rowPosition = 0;
+    rowset.close();
+    getDataBindings.reset();
+
+    size_t maxRows = SIZE_MAX;
+    if (!eof && maxRowsPerSelect > 0) {
+        if (rowCountPerSelect >= maxRowsPerSelect) {
+            closeAtMaxRows();
+        } else {
+            maxRows = maxRowsPerSelect - rowCountPerSelect;
+        }
+    }
+    if (eof) {
+        maxRows = 0;
+    }
+
+    OutputFile output(fd);
+    size_t     rows = 0;
+    bool       written = false;
+    try {
+        if (options->format == NUOODBC_EXPORT_CSV) {
+            written = ResultExport::writeCsv(resultSet, ResultExport::describeCsv(metaData), connection->getTimeZoneCache(),
+                                             *options, maxRows, output, &rows);
+        } else {
+            written = ResultExport::writeArrowIpc(resultSet, ArrowExport::describe(metaData), connection->getTimeZoneCache(),
+                                                  *options, maxRows, output, &rows);
+        }
+    } catch (SQLException& exception) {
+        postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+        return SQL_ERROR;
+    }
+
+    rowCountPerSelect += rows;
+    eof = true;
+    if (rowCount) {
+        *rowCount = (SQLLEN)rows;
+    }
+
+    if (!written) {
+        return sqlReturn(SQL_ERROR, "HY000", formatString("Export write failed: %s", strerror(output.getError())).c_str());
+    }
+
+    return sqlSuccess();
+}
+
+// Fetch the rowset that follows the cursor.
+RETCODE OdbcStatement::fetchRowset()
 {
     TRACE(formatString("SQLFetch on: %s", sqlStmt.c_str()).c_str());
     if (!resultSet) {
@@ -313,27 +700,78 @@ RETCODE OdbcStatement::sqlFetch()
         }
     }
 
+    // the rows of the last rowset aren't this one's
+    clearErrors();
+
     if (cancel) {
         releaseResultSet();
         return sqlReturn(SQL_ERROR, "S1008", "Operation canceled");
     }
 
+    rowCountPerFetch = 0;
+    rowPosition = 0;
+
+    // SQL_RD_OFF: only the cursor moves, nothing is converted
+    if (!retrieveData) {
+        rowset.close();
+        return fetchBlock(false);
+    }
+
+    if (!fetchPlan.isValid()) {
+        try {
+            fetchPlan.compile(fetchBindings, resultSet, rowSize, maxLength, connection->getTimeZoneCache(), applicationRowDescriptor.get());
+        } catch (SQLException& exception) {
+            postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+            return SQL_ERROR;
+        }
+    }
+
+    // A block cursor keeps the columns it leaves unbound, so that SQLGetData
+    // can read them on any row of the rowset once SQLSetPos has positioned
+    // the cursor on it.  The bound ones are in the application's buffers
+    // already, and aren't copied.
+    std::vector<int> unbound;
+    if (rowArraySize > 1) {
+        unbound = getUnboundColumns();
+    }
+    if (!unbound.empty()) {
+        if (!rowset.isOpen() || rowset.getColumns() != unbound) {
+            rowset.open(metaData, connection->getTimeZoneCache(), unbound, connection->getMemoryAccount());
+        }
+        rowset.clear();
+    } else if (rowset.isOpen()) {
+        rowset.close();
+    }
+
+    // large rowsets can be converted by the environment's workers
+    bool parallel = parallelFetchRows > 0 && rowArraySize >= (SQLULEN)parallelFetchRows && fetchPlan.canStage();
+
+    if (rowArraySize > 1 && (rowSize == SQL_BIND_BY_COLUMN || parallel)) {
+        return fetchBlock(parallel);
+    }
+
     if (rowStatusPtr) {
         for (SQLULEN row = 0; row < rowArraySize; row++) {
             rowStatusPtr[row] = SQL_NO_DATA;
         }
     }
 
-    rowCountPerFetch = 0;
+    // A row that fails to convert is marked SQL_ROW_ERROR and the fetch
+    // goes on; the rowset is an error only if all its rows are.
+    SQLULEN errorRows = 0;
+    auto    rowsetReturn = [&]() { return errorRows > 0 && errorRows == rowCountPerFetch ? SQL_ERROR : sqlSuccess(); };
 
     for (SQLULEN row = 0; row < rowArraySize; row++) {
 
         try {
 
-            if (eof || (maxRowsPerSelect > 0 && rowCountPerSelect >= maxRowsPerSelect) || !resultSet->next()) {
+            if (!eof && maxRowsPerSelect > 0 && rowCountPerSelect >= maxRowsPerSelect) {
+                closeAtMaxRows();
+            }
+            if (eof || !resultSet->next()) {
                 eof = true;
                 TRACE("No more data");
-                return rowCountPerFetch > 0 ? sqlSuccess() : SQL_NO_DATA;
+                return rowCountPerFetch > 0 ? rowsetReturn() : SQL_NO_DATA;
             } else {
                 TRACE(formatString("more data on row " SQLULEN_FMT, rowCountPerFetch).c_str());
             }
@@ -342,22 +780,26 @@ RETCODE OdbcStatement::sqlFetch()
             return SQL_ERROR;
         }
 
-        fetchBindings.reset();
-
-        for (int n = 1; n <= fetchBindings.getCount(); ++n) {
-            Binding* binding = fetchBindings.getBinding(n);
+        int rowRet = fetchPlan.fetchRow(this, resultSet, rowCountPerFetch);
+        if (rowRet == SQL_ERROR) {
+            errorRows++;
+        }
 
-            if (binding->pointer && binding->type != SQL_PARAM_INPUT) {
-                if (setValue(binding, n, false, rowCountPerFetch, rowSize) == SQL_ERROR) {
-                    return SQL_ERROR;
-                }
+        if (rowset.isOpen()) {
+            try {
+                rowset.stage(resultSet);
+            } catch (SQLException& exception) {
+                postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+                return SQL_ERROR;
             }
         }
 
         getDataBindings.reset();
 
         if (rowStatusPtr) {
-            rowStatusPtr[rowCountPerFetch] = SQL_ROW_SUCCESS;
+            rowStatusPtr[rowCountPerFetch] = rowRet == SQL_ERROR ? SQL_ROW_ERROR
+                                           : rowRet == SQL_SUCCESS_WITH_INFO ? SQL_ROW_SUCCESS_WITH_INFO
+                                           : SQL_ROW_SUCCESS;
         }
 
         rowCountPerFetch++;
@@ -368,33 +810,132 @@ RETCODE OdbcStatement::sqlFetch()
         }
     }
 
+    return rowsetReturn();
+}
+
+// SQL_ATTR_MAX_ROWS rows have been fetched: no more will be read from the
+// server's cursor, so it's closed now rather than with the statement.  A
+// scrollable cursor keeps its rows, and stops reading at the limit itself.
+void OdbcStatement::closeAtMaxRows()
+{
+    eof = true;
+    if (!scroller) {
+        TRACE("SQL_ATTR_MAX_ROWS reached, closing the cursor");
+        resultSet->close();
+    }
+}
+
+// Fetch a whole rowset through the block path of the fetch plan: either
+// column-wise bound, or converted in parallel.  With SQL_RD_OFF the rows
+// are only counted.
+RETCODE OdbcStatement::fetchBlock(bool parallel)
+{
+    SQLULEN maxRows = rowArraySize;
+    if (maxRowsPerSelect > 0) {
+        maxRows = rowCountPerSelect < maxRowsPerSelect ? std::min(maxRows, maxRowsPerSelect - rowCountPerSelect) : 0;
+    }
+
+    if (!eof && maxRows == 0) {
+        try {
+            closeAtMaxRows();
+        } catch (SQLException& exception) {
+            postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+            return SQL_ERROR;
+        }
+    }
+
+    int ret = SQL_SUCCESS;
+    if (!eof && maxRows > 0) {
+        TRACE(formatString("block fetch of up to " SQLULEN_FMT " rows", maxRows).c_str());
+        if (!retrieveData) {
+            try {
+                while (rowCountPerFetch < maxRows && resultSet->next()) {
+                    rowCountPerFetch++;
+                }
+            } catch (SQLException& exception) {
+                postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
+                ret = SQL_ERROR;
+            }
+            if (rowStatusPtr) {
+                std::fill(rowStatusPtr, rowStatusPtr + rowCountPerFetch, (SQLUSMALLINT)SQL_ROW_SUCCESS);
+            }
+        } else {
+            // the plan sets the status of each row it fetches
+            StagedRowset* rows = rowset.isOpen() ? &rowset : nullptr;
+            ret = parallel ? fetchPlan.fetchParallel(this, resultSet, maxRows, &rowCountPerFetch, rowStatusPtr, connection->getEnv()->getWorkerPool(), rows)
+                           : fetchPlan.fetchBlock(this, resultSet, maxRows, &rowCountPerFetch, rowStatusPtr, rows);
+        }
+    }
+
+    getDataBindings.reset();
+    rowCountPerSelect += rowCountPerFetch;
+
+    if (rowStatusPtr) {
+        std::fill(rowStatusPtr + rowCountPerFetch, rowStatusPtr + rowArraySize, (SQLUSMALLINT)SQL_NO_DATA);
+    }
+
+    if (rowCountPerFetchPtr) {
+        *rowCountPerFetchPtr = rowCountPerFetch;
+    }
+
+    if (ret == SQL_ERROR) {
+        return SQL_ERROR;
+    }
+
+    if (rowCountPerFetch < rowArraySize) {
+        eof = true;
+        TRACE("No more data");
+        if (rowCountPerFetch == 0) {
+            return SQL_NO_DATA;
+        }
+    }
+
     return sqlSuccess();
 }
 
-int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemaining, SQLULEN rowIndex, SQLULEN rowSize)
+// The columns of the result set the fetch plan leaves to SQLGetData.
+std::vector<int> OdbcStatement::getUnboundColumns() const
+{
+    std::vector<bool> bound(numberColumns + 1, false);
+    for (const FetchColumn& column : fetchPlan.getColumns()) {
+        if (column.column >= 1 && column.column <= numberColumns) {
+            bound[column.column] = true;
+        }
+    }
+
+    std::vector<int> unbound;
+    for (int column = 1; column <= numberColumns; ++column) {
+        if (!bound[column]) {
+            unbound.push_back(column);
+        }
+    }
+    return unbound;
+}
+
+// Whether column is a CLOB read with SQLGetData, which is streamed through
+// state rather than read whole.
+bool OdbcStatement::isStreamedClob(ResultSet* results, int column, BindingState* state)
+{
+    if (!state || !results) {
+        return false;
+    }
+    return state->lob.isOpen() || metaData->getColumnType(column) == (int)NUOSQL_CLOB;
+}
+
+int OdbcStatement::setValue(ResultSet* results, Binding* binding, int column, bool indicatorIsRemaining, BindingState* state)
 {
-    TRACE(formatString("setValue on '%s' column %d type %d buflen " SQLLEN_FMT " offset " SQLLEN_FMT " rowIndex " SQLULEN_FMT " rowSize " SQLULEN_FMT, sqlStmt.c_str(), column, binding->cType, binding->bufferLength, binding->offset, rowIndex, rowSize).c_str());
+    TRACE(formatString("setValue on '%s' column %d type %d buflen " SQLLEN_FMT " offset " SQLLEN_FMT, sqlStmt.c_str(), column, binding->cType, binding->bufferLength, binding->offset).c_str());
     SQLLEN  bufferLength = binding->bufferLength;
     int     exitCode = SQL_SUCCESS;
     int     cType;
-    PTR     bufferPtr;
-    PTR     indicatorPtr;
+    PTR     bufferPtr = binding->pointer;
+    PTR     indicatorPtr = binding->indicatorPointer;
     SQLLEN  remainingBytes = 0;
-
-    if (rowSize == SQL_BIND_BY_COLUMN) {
-        bufferPtr = binding->pointer;
-        indicatorPtr = (char*)binding->indicatorPointer + (rowIndex * sizeof(SQLLEN));
-        // rowIndex is still interesting in this case.  We need to calc the offset on a pertype basis
-    } else {
-        bufferPtr = (char*)binding->pointer + (rowIndex*rowSize);
-        indicatorPtr = binding->indicatorPointer ? ((char*)binding->indicatorPointer + (rowIndex*rowSize)) : 0;
-        // we no longer care about the rowIndex in this function, since we have just calculated the offset
-        rowIndex = 0;
-    }
+    bool    fromCache = false;
 
     switch (binding->cType) {
         case SQL_C_DEFAULT:
-            cType = convertFromSQL_C_DEFAULT((int)OdbcTypeMapper::mapType(resultSet->getMetaData()->getColumnType(column)));
+            cType = convertFromSQL_C_DEFAULT((int)OdbcTypeMapper::mapType(results->getMetaData()->getColumnType(column)));
             break;
 
         default:
@@ -409,9 +950,118 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                     return sqlReturn(SQL_ERROR, "HY090", "Invalid string or buffer length");
                 }
 
-                bufferPtr = (char*)bufferPtr + (bufferLength * rowIndex);
-                const char* string = RESULTS(getString(column));
-                SQLLEN stringLen = string == NULL ? 0 : strlen(string);
+                if (isStreamedClob(results, column, state)) {
+                    // the UTF-8 bytes of the value, read a piece at a time
+                    LobStream* lob = &state->lob;
+                    fromCache = lob->isOpen();
+                    if (!fromCache) {
+                        lob->open(results->getClob(column), maxLength, true);
+                    }
+
+                    SQLLEN length = lob->getLength();
+                    remainingBytes = length - binding->offset;
+                    SQLLEN maxlen = std::min<SQLLEN>(bufferLength-1, remainingBytes);
+
+                    if (remainingBytes <= 0 || maxlen < 0) {
+                        maxlen = 0;
+                    } else {
+                        lob->read(binding->offset, (char*)bufferPtr, maxlen);
+
+                        if (maxlen != remainingBytes) {
+                            exitCode = SQL_SUCCESS_WITH_INFO;
+                            std::ostringstream msg;
+                            msg << "Data truncated on column " << column << ", need length " << remainingBytes << " only have " << maxlen;
+                            postError("01004", msg.str());
+                        }
+                    }
+
+                    binding->offset += maxlen;
+                    if (bufferLength > 0 && (maxlen > 0 || binding->count == 0)) {
+                        ((char*)(bufferPtr))[maxlen] = 0;   // always null terminated
+                    }
+                    bufferLength = maxlen;
+                    break;
+                }
+
+                int columnType = results ? metaData->getColumnType(column) : 0;
+                if (OdbcTypeMapper::isInlineBinary(columnType) || columnType == (int)NUOSQL_BLOB) {
+                    // two hex digits a byte, encoded straight into the
+                    // buffer; a piece may end half way through a byte
+                    SQLLEN length;
+                    SQLLEN maxlen;
+                    if (OdbcTypeMapper::isInlineBinary(columnType)) {
+                        Bytes bytes = results->getBytes(column);
+                        length = bytes.data ? 2 * (SQLLEN)bytes.length : 0;
+                        if (maxLength > 0 && length > (SQLLEN)maxLength) {
+                            length = (SQLLEN)maxLength;
+                        }
+                        remainingBytes = length - binding->offset;
+                        maxlen = std::min<SQLLEN>(bufferLength-1, remainingBytes);
+                        if (remainingBytes > 0 && maxlen > 0) {
+                            HexCodec::encodeDigits(bytes.data, binding->offset, maxlen, (char*)bufferPtr);
+                        }
+                    } else {
+                        LobStream  single;
+                        LobStream* lob = state ? &state->lob : &single;
+                        fromCache = lob->isOpen();
+                        if (!fromCache) {
+                            lob->open(results->getBlob(column), maxLength > 0 ? (maxLength + 1) / 2 : 0, state != nullptr);
+                        }
+                        length = 2 * lob->getLength();
+                        if (maxLength > 0 && length > (SQLLEN)maxLength) {
+                            length = (SQLLEN)maxLength;
+                        }
+                        remainingBytes = length - binding->offset;
+                        maxlen = std::min<SQLLEN>(bufferLength-1, remainingBytes);
+                        if (remainingBytes > 0 && maxlen > 0) {
+                            SQLLEN first = binding->offset / 2;
+                            std::vector<char> bytes((binding->offset + maxlen + 1) / 2 - first);
+                            lob->read(first, bytes.data(), (SQLLEN)bytes.size());
+                            HexCodec::encodeDigits((const uint8_t*)bytes.data(), binding->offset % 2, maxlen, (char*)bufferPtr);
+                        }
+                    }
+
+                    if (remainingBytes <= 0 || maxlen < 0) {
+                        maxlen = 0;
+                    } else if (maxlen != remainingBytes) {
+                        exitCode = SQL_SUCCESS_WITH_INFO;
+                        std::ostringstream msg;
+                        msg << "Data truncated on column " << column << ", need length " << remainingBytes << " only have " << maxlen;
+                        postError("01004", msg.str());
+                    }
+
+                    binding->offset += maxlen;
+                    if (bufferLength > 0 && (maxlen > 0 || binding->count == 0)) {
+                        ((char*)(bufferPtr))[maxlen] = 0;   // always null terminated
+                    }
+                    bufferLength = maxlen;
+                    break;
+                }
+
+                const char* string;
+                SQLLEN stringLen;
+                char text[TEXT_FORMAT_MAX];
+                TextFormat::TextKind textKind = TextFormat::TextKind::None;
+                fromCache = state && state->cached && binding->offset > 0;
+                if (fromCache) {
+                    string = state->value.data();
+                    stringLen = state->value.size();
+                } else if (results && (textKind = TextFormat::getTextKind(metaData, column)) != TextFormat::TextKind::None) {
+                    // typed values are written by the driver; see TextFormat
+                    int length = TextFormat::formatColumn(results, column, textKind, connection->getTimeZoneCache(), text);
+                    string = length < 0 ? NULL : text;
+                    stringLen = length < 0 ? 0 : length;
+                } else if (results) {
+                    int length = 0;
+                    string = results->getString(column, &length);
+                    stringLen = string == NULL ? 0 : length;
+                } else {
+                    string = callableStatement->getString(column);
+                    stringLen = string == NULL ? 0 : strlen(string);
+                }
+                if (maxLength > 0 && stringLen > (SQLLEN)maxLength) {
+                    stringLen = (SQLLEN)maxLength;
+                }
                 SQLLEN valueLength = stringLen - binding->offset;
                 SQLLEN maxlen = std::min<SQLLEN>(bufferLength-1, valueLength);
 
@@ -420,6 +1070,15 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                 } else {
                     memcpy(bufferPtr, string + binding->offset, maxlen);
 
+                    // the rest will be read by later calls: hang on to it
+                    if (maxlen != valueLength && state && !state->cached) {
+                        if (!chargeOrFail(state, stringLen)) {
+                            return SQL_ERROR;
+                        }
+                        state->value.assign(string, stringLen);
+                        state->cached = true;
+                    }
+
                     if (maxlen != valueLength) {
                         exitCode = SQL_SUCCESS_WITH_INFO;
                         std::ostringstream msg;
@@ -454,17 +1113,81 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                     return sqlReturn(SQL_ERROR, "HY090", "Invalid string or buffer length");
                 }
 
-                bufferPtr = (char*)bufferPtr + (bufferLength * rowIndex);
-                widestring wString = std::wstring_convert<std::codecvt_utf8_utf16<widechar_t>, widechar_t>{}.from_bytes(RESULTS(getString(column)));
+                if (isStreamedClob(results, column, state)) {
+                    // Transcoded a piece at a time, so the length in UTF-16
+                    // isn't known until the last piece.
+                    LobStream* lob = &state->lob;
+                    fromCache = lob->isOpen();
+                    if (!fromCache) {
+                        lob->open(results->getClob(column), maxLength, true);
+                    }
+
+                    size_t written = 0;
+                    if (bufferLength >= 2 && !lob->readWide((char16_t*)bufferPtr, (bufferLength-2) / 2, &written)) {
+                        return sqlReturn(SQL_ERROR, "HY000", "invalid UTF-8 code sequence");
+                    }
+                    SQLLEN maxlen = 2 * (SQLLEN)written;
+
+                    if (lob->isWideDone()) {
+                        remainingBytes = maxlen;
+                    } else {
+                        remainingBytes = SQL_NO_TOTAL;
+                        exitCode = SQL_SUCCESS_WITH_INFO;
+                        std::ostringstream msg;
+                        msg << "Data truncated on column " << column << ", only have " << maxlen;
+                        postError("01004", msg.str());
+                    }
+
+                    binding->offset += maxlen;
+                    if (bufferLength >= 2 && (maxlen > 0 || binding->count == 0)) {
+                        ((char16_t*)(bufferPtr))[written] = 0;   // always null terminated
+                    }
+                    bufferLength = maxlen;
+                    break;
+                }
+
+                std::u16string transcoded;
+                fromCache = state && state->cached && binding->offset > 0;
+                if (!fromCache) {
+                    int length = 0;
+                    char text[TEXT_FORMAT_MAX];
+                    TextFormat::TextKind textKind = results ? TextFormat::getTextKind(metaData, column) : TextFormat::TextKind::None;
+                    const char* string;
+                    if (textKind != TextFormat::TextKind::None) {
+                        length = TextFormat::formatColumn(results, column, textKind, connection->getTimeZoneCache(), text);
+                        string = length < 0 ? NULL : text;
+                    } else {
+                        string = results ? results->getString(column, &length) : callableStatement->getString(column);
+                    }
+                    if (string && !results) {
+                        length = (int)strlen(string);
+                    }
+                    if (string && !Transcoder::utf8ToUtf16(string, length, transcoded)) {
+                        return sqlReturn(SQL_ERROR, "HY000", "invalid UTF-8 code sequence");
+                    }
+                }
+                const std::u16string& wString = fromCache ? state->wideValue : transcoded;
                 SQLLEN stringLen = 2* wString.length(); // Number of bytes to copy = 2 * length of wide chars string
+                if (maxLength > 0) {
+                    stringLen = std::min<SQLLEN>(stringLen, (SQLLEN)(maxLength & ~(SQLULEN)1));
+                }
                 SQLLEN valueLength = stringLen - binding->offset;
-                SQLLEN maxlen = std::min<SQLLEN>(bufferLength-2, valueLength); // 2 byes for a null terminated wide char string
+                SQLLEN maxlen = std::min<SQLLEN>(bufferLength-2, valueLength) & ~(SQLLEN)1; // 2 byes for a null terminated wide char string
 
                 if (valueLength <= 0 || maxlen < 0) {
                     maxlen = 0;
                 } else {
                     memcpy((char*)bufferPtr, (char*)wString.data() + binding->offset, maxlen);
 
+                    // the rest will be read by later calls: hang on to it
+                    if (maxlen != valueLength && state && !state->cached) {
+                        if (!chargeOrFail(state, 2 * transcoded.size())) {
+                            return SQL_ERROR;
+                        }
+                        state->wideValue.swap(transcoded);
+                        state->cached = true;
+                    }
+
                     if (maxlen != valueLength) {
                         exitCode = SQL_SUCCESS_WITH_INFO;
                         std::ostringstream msg;
@@ -500,16 +1223,51 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                     return sqlReturn(SQL_ERROR, "HY090", "Invalid string or buffer length");
                 }
 
-                bufferPtr = (char*)bufferPtr + (bufferLength * rowIndex);
-                NuoDB::Blob* blob = RESULTS(getBlob(column));
+                if (results && OdbcTypeMapper::isInlineBinary(metaData->getColumnType(column))) {
+                    // BINARY and VARBINARY values come with the row: copy
+                    // them straight out rather than through a Blob
+                    Bytes  bytes = results->getBytes(column);
+                    SQLLEN length = bytes.data ? bytes.length : 0;
+                    if (maxLength > 0 && length > (SQLLEN)maxLength) {
+                        length = (SQLLEN)maxLength;
+                    }
+                    remainingBytes = length - binding->offset;
+                    SQLLEN maxlen = std::min<SQLLEN>(bufferLength, remainingBytes);
+
+                    if (remainingBytes <= 0 || maxlen < 0) {
+                        maxlen = 0;
+                    } else {
+                        memcpy(bufferPtr, bytes.data + binding->offset, maxlen);
+
+                        if (maxlen != remainingBytes) {
+                            exitCode = SQL_SUCCESS_WITH_INFO;
+                            std::ostringstream msg;
+                            msg << "Data truncated on column " << column << ", need length " << remainingBytes << " only have " << maxlen;
+                            postError("01004", msg.str());
+                        }
+                    }
+
+                    binding->offset += maxlen;
+                    bufferLength = maxlen;
+                    break;
+                }
+
+                // A value read in pieces keeps its stream until the next row;
+                // otherwise it's read in one go.
+                LobStream  single;
+                LobStream* lob = state ? &state->lob : &single;
+                if (!lob->isOpen()) {
+                    lob->open(RESULTS(getBlob(column)), maxLength, state != nullptr);
+                }
 
-                remainingBytes = blob->length() - binding->offset;
+                SQLLEN length = lob->getLength();
+                remainingBytes = length - binding->offset;
                 SQLLEN maxlen = std::min<SQLLEN>(bufferLength, remainingBytes);
 
                 if (remainingBytes <= 0 || maxlen < 0) {
                     maxlen = 0;
                 } else {
-                    blob->getBytes((int)binding->offset, (int)maxlen, (unsigned char*)bufferPtr);
+                    lob->read(binding->offset, (char*)bufferPtr, maxlen);
 
                     if (maxlen != remainingBytes) {
                         exitCode = SQL_SUCCESS_WITH_INFO;
@@ -521,7 +1279,7 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
 
                 // if we have reached the end and this is a single call then reset
 
-                if (binding->offset + maxlen > blob->length() && binding->count == 0) { // reached the end
+                if (binding->offset + maxlen > length && binding->count == 0) { // reached the end
                     binding->offset = 0;
                 } else {
                     binding->offset += maxlen;
@@ -531,10 +1289,33 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                 break;
             }
 
+            case SQL_C_NUODB_FILE: {
+                // the whole value, written to the file named in the buffer;
+                // a second call has no more
+                if (binding->count > 0) {
+                    remainingBytes = bufferLength = 0;
+                    break;
+                }
+                if (!results) {
+                    postError("07006", "Restricted data type attribute violation");
+                    return SQL_ERROR;
+                }
+                const char* path = LobFile::getPath(bufferPtr, bufferLength);
+                if (!path) {
+                    return sqlReturn(SQL_ERROR, "HY090", "Invalid string or buffer length");
+                }
+                SQLLEN written = 0;
+                if (!LobFile::writeColumn(results, column, metaData->getColumnType(column), maxLength, path, &written)) {
+                    postError("HY000", formatString("Cannot write %s: %s", path, strerror(errno)));
+                    return SQL_ERROR;
+                }
+                remainingBytes = bufferLength = written;
+                break;
+            }
+
             case SQL_C_SSHORT:
             case SQL_C_USHORT:
             case SQL_C_SHORT:
-                bufferPtr = (char*)bufferPtr + (sizeof(short) * rowIndex);
                 *((short*)bufferPtr) = RESULTS(getShort(column));
                 remainingBytes = bufferLength = sizeof(short);
                 break;
@@ -545,19 +1326,16 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
             case SQL_C_SLONG:
             case SQL_C_ULONG:
             case SQL_C_LONG:
-                bufferPtr = (char*)bufferPtr + (sizeof(int) * rowIndex);
                 *((int*)bufferPtr) = RESULTS(getInt(column));
                 remainingBytes = bufferLength = sizeof(int);
                 break;
 
             case SQL_C_FLOAT:
-                bufferPtr = (char*)bufferPtr + (sizeof(float) * rowIndex);
                 *((float*)bufferPtr) = RESULTS(getFloat(column));
                 remainingBytes = bufferLength = sizeof(float);
                 break;
 
             case SQL_C_DOUBLE:
-                bufferPtr = (char*)bufferPtr + (sizeof(double) * rowIndex);
                 *((double*)bufferPtr) = RESULTS(getDouble(column));
                 remainingBytes = bufferLength = sizeof(double);
                 break;
@@ -565,32 +1343,36 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
             case SQL_C_STINYINT:
             case SQL_C_UTINYINT:
             case SQL_C_TINYINT:
-                bufferPtr = (char*)bufferPtr + (sizeof(char) * rowIndex);
                 *((char*)bufferPtr) = RESULTS(getByte(column));
                 remainingBytes = bufferLength = sizeof(char);
                 break;
 
             case SQL_C_SBIGINT:
             case SQL_C_UBIGINT:
-                bufferPtr = (char*)bufferPtr + (sizeof(int64_t) * rowIndex);
                 *((int64_t*)bufferPtr) = RESULTS(getLong(column));
                 remainingBytes = bufferLength = sizeof(int64_t);
                 break;
 
             case SQL_TYPE_DATE:
             case SQL_C_DATE: {
-                bufferPtr = (char*)bufferPtr + (sizeof(tagDATE_STRUCT) * rowIndex);
                 NuoDB::Date*    date = RESULTS(getDate(column));
-                time_t          time_secs = date->getSeconds();
+                if (!date) {
+                    // only a prefetched result set has none to hand out
+                    if (!RESULTS(wasNull())) {
+                        postError("07006", "Restricted data type attribute violation");
+                        return SQL_ERROR;
+                    }
+                    remainingBytes = bufferLength = sizeof(tagDATE_STRUCT);
+                    break;
+                }
+                DateTime::Fields fields;
+                connection->getTimeZoneCache()->toLocal(date->getSeconds(), &fields);
                 date->release();
 
-                struct tm local_time;
-                localtime_r(&time_secs, &local_time);
-
                 tagDATE_STRUCT* var = (tagDATE_STRUCT*)bufferPtr;
-                var->year = local_time.tm_year + 1900;
-                var->month = local_time.tm_mon + 1;
-                var->day = local_time.tm_mday;
+                var->year = (SQLSMALLINT)fields.year;
+                var->month = fields.month;
+                var->day = fields.day;
 
                 remainingBytes = bufferLength = sizeof(tagDATE_STRUCT);
                 break;
@@ -598,22 +1380,28 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
 
             case SQL_TYPE_TIMESTAMP:
             case SQL_C_TIMESTAMP: {
-                bufferPtr = (char*)bufferPtr + (sizeof(tagTIMESTAMP_STRUCT) * rowIndex);
                 NuoDB::Timestamp*       timestamp = RESULTS(getTimestamp(column));
-                time_t                  time_secs = timestamp->getSeconds();
+                if (!timestamp) {
+                    // only a prefetched result set has none to hand out
+                    if (!RESULTS(wasNull())) {
+                        postError("07006", "Restricted data type attribute violation");
+                        return SQL_ERROR;
+                    }
+                    remainingBytes = bufferLength = sizeof(tagTIMESTAMP_STRUCT);
+                    break;
+                }
                 tagTIMESTAMP_STRUCT*    var = (tagTIMESTAMP_STRUCT*)bufferPtr;
-                var->fraction = timestamp->getNanos() * 10;
+                DateTime::Fields        fields;
+                connection->getTimeZoneCache()->toLocal(timestamp->getSeconds(), &fields);
+                var->fraction = timestamp->getNanos();  // the ODBC fraction is in nanoseconds too
                 timestamp->release();
 
-                struct tm local_time;
-                localtime_r(&time_secs, &local_time);
-
-                var->year = local_time.tm_year + 1900;
-                var->month = local_time.tm_mon + 1;
-                var->day = local_time.tm_mday;
-                var->hour = local_time.tm_hour;
-                var->minute = local_time.tm_min;
-                var->second = local_time.tm_sec;
+                var->year = (SQLSMALLINT)fields.year;
+                var->month = fields.month;
+                var->day = fields.day;
+                var->hour = fields.hour;
+                var->minute = fields.minute;
+                var->second = fields.second;
 
                 remainingBytes = bufferLength = sizeof(tagTIMESTAMP_STRUCT);
                 break;
@@ -621,23 +1409,54 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
 
             case SQL_C_TIME:
             case SQL_TYPE_TIME: {
-                bufferPtr = (char*)bufferPtr + (sizeof(tagTIME_STRUCT) * rowIndex);
                 NuoDB::Time*    time = RESULTS(getTime(column));
-                time_t          time_secs = time->getSeconds();
+                if (!time) {
+                    // only a prefetched result set has none to hand out
+                    if (!RESULTS(wasNull())) {
+                        postError("07006", "Restricted data type attribute violation");
+                        return SQL_ERROR;
+                    }
+                    remainingBytes = bufferLength = sizeof(tagTIME_STRUCT);
+                    break;
+                }
+                DateTime::Fields fields;
+                connection->getTimeZoneCache()->toLocal(time->getSeconds(), &fields);
                 time->release();
 
-                struct tm local_time;
-                localtime_r(&time_secs, &local_time);
-
                 tagTIME_STRUCT* var = (tagTIME_STRUCT*)bufferPtr;
-                var->hour = local_time.tm_hour;
-                var->minute = local_time.tm_min;
-                var->second = local_time.tm_sec;
+                var->hour = fields.hour;
+                var->minute = fields.minute;
+                var->second = fields.second;
 
                 remainingBytes = bufferLength = sizeof(tagTIME_STRUCT);
                 break;
             }
 
+            case SQL_C_NUMERIC: {
+                int precision = NUMERIC_MAX_PRECISION;
+                int scale = 0;
+                if (!applicationRowDescriptor->getPrecisionAndScale(column, &precision, &scale) && metaData) {
+                    precision = metaData->getPrecision(column);
+                    scale = metaData->getScale(column);
+                }
+
+                int length = 0;
+                const char* string = results ? results->getString(column, &length) : callableStatement->getString(column);
+                if (string) {
+                    Numeric::Status status = Numeric::fromString(string, results ? length : strlen(string), precision, scale, (SQL_NUMERIC_STRUCT*)bufferPtr);
+                    if (status != Numeric::Status::Ok) {
+                        postError(Numeric::getSqlState(status), Numeric::getMessage(status));
+                        if (status != Numeric::Status::FractionTruncated) {
+                            return SQL_ERROR;
+                        }
+                        exitCode = SQL_SUCCESS_WITH_INFO;
+                    }
+                }
+
+                remainingBytes = bufferLength = sizeof(SQL_NUMERIC_STRUCT);
+                break;
+            }
+
             default:
                 std::ostringstream message;
                 message << "Optional feature not implemented, type " << cType << " not supported on column " << column;
@@ -645,12 +1464,15 @@ int OdbcStatement::setValue(Binding* binding, int column, bool indicatorIsRemain
                 return SQL_ERROR;
         }
 
-        if (RESULTS(wasNull())) {
+        if (!fromCache && RESULTS(wasNull())) {
             remainingBytes = SQL_NULL_DATA;
             bufferLength = SQL_NULL_DATA;
         } else if (bufferLength == 0 && binding->count > 0) { // offset will be > 0 when called multiple times
             exitCode = SQL_NO_DATA;
             binding->reset(); // at the end so reset
+            if (state) {
+                state->reset();
+            }
         } else {
             binding->count++;
         }
@@ -688,7 +1510,7 @@ RETCODE OdbcStatement::sqlColumns(SQLCHAR* catalog, SQLSMALLINT catLength, SQLCH
     try {
         DatabaseMetaData* dbMetaData = connection->getMetaData();
         auto rSet = new ResultSetMapper(dbMetaData->getColumns(cat, scheme, tbl, col), new OdbcTypeMapper());
-        setResultSet(rSet);
+        setResultSet(rSet, true);
     } catch (SQLException& exception) {
         postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
         return SQL_ERROR;
@@ -708,6 +1530,7 @@ RETCODE OdbcStatement::sqlFreeStmt(SQLUSMALLINT option)
 
         case SQL_UNBIND:
             fetchBindings.release();
+            fetchPlan.invalidate();
             break;
 
         case SQL_RESET_PARAMS:
@@ -825,8 +1648,10 @@ RETCODE OdbcStatement::sqlDescribeCol(SQLUSMALLINT col, SQLCHAR* colName, SQLSMA
 
             setString(name, colName, nameSize, nameLength);
         }
+        // the same sizes as SQLColAttribute reports
+        ColumnSize size = columnSizes.get(connection->getMetaData(), metaData, col);
         if (sqlType) {
-            *sqlType = (int32_t)OdbcTypeMapper::mapType(metaData->getColumnType(col));
+            *sqlType = (int32_t)size.sqlType;
             // some system queries return an hardcoded NULL value for columns we
             // don't have in the metadata; publish them as VARCHAR columns
             if ((SqlType)*sqlType == NUOSQL_NULL) {
@@ -837,7 +1662,7 @@ RETCODE OdbcStatement::sqlDescribeCol(SQLUSMALLINT col, SQLCHAR* colName, SQLSMA
             *scale = metaData->getScale(col);
         }
         if (precision) {
-            *precision = metaData->getPrecision(col);
+            *precision = size.columnSize;
         }
         if (nullable) {
             *nullable = metaData->isNullable(col) ? SQL_NULLABLE : SQL_NO_NULLS;
@@ -862,14 +1687,59 @@ RETCODE OdbcStatement::sqlGetData(SQLUSMALLINT column, SQLSMALLINT cType, SQLPOI
     binding->bufferLength = bufferLength;
     binding->indicatorPointer = indicatorPointer;
 
+    // only strings and BLOBs are worth keeping around between calls
+    BindingState* state = nullptr;
+    if (cType == SQL_C_CHAR || cType == SQL_C_WCHAR || cType == SQL_C_BINARY || cType == SQL_C_DEFAULT) {
+        state = getDataBindings.getState(column);
+    }
+
+    // An unbound column of a block cursor is read on any row of the rowset
+    // through a view on the kept rows; any other only on the cursor's row,
+    // the last of a full rowset.
+    ResultSet* results = resultSet;
+    if (rowset.isOpen() && rowset.hasColumn(column)) {
+        results = rowset.getRow(rowPosition);
+    } else if (resultSet && rowArraySize > 1 && rowCountPerFetch > 0 && (eof || rowPosition != rowCountPerFetch - 1)) {
+        return sqlReturn(SQL_ERROR, "HY109", "Invalid cursor position");
+    }
+
     try {
-        return setValue(binding, column, true);
+        return setValue(results, binding, column, true, state);
     } catch (SQLException& exception) {
         postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
         return SQL_ERROR;
     }
 }
 
+// Only SQL_POSITION: it picks the row of the rowset that SQLGetData reads.
+RETCODE OdbcStatement::sqlSetPos(SQLSETPOSIROW row, SQLUSMALLINT operation, SQLUSMALLINT lockType)
+{
+    clearErrors();
+
+    if (!resultSet || rowCountPerFetch == 0) {
+        return sqlReturn(SQL_ERROR, "24000", "Invalid cursor state");
+    }
+
+    if (operation != SQL_POSITION || lockType != SQL_LOCK_NO_CHANGE) {
+        return sqlReturn(SQL_ERROR, "HYC00", "Optional feature not implemented");
+    }
+
+    if (row == 0) {
+        return sqlReturn(SQL_ERROR, "HY109", "Invalid cursor position");
+    }
+
+    if (row > rowCountPerFetch) {
+        return sqlReturn(SQL_ERROR, "HY107", "Row value out of range");
+    }
+
+    if (rowPosition != row - 1) {
+        rowPosition = row - 1;
+        getDataBindings.reset();
+    }
+
+    return sqlSuccess();
+}
+
 RETCODE OdbcStatement::sqlExecute()
 {
     clearErrors();
@@ -917,10 +1787,20 @@ ResultSet* OdbcStatement::getResultSet()
         }
     }
 
+    releaseResultSet();
     if (!statement->getMoreResults()) {
         return NULL;
     }
-    setResultSet(statement->getResultSet());
+
+    ResultSet* results = statement->getResultSet();
+    if (prefetchRows > 0 && PrefetchResultSet::canPrefetch(results)) {
+        results = new PrefetchResultSet(results, prefetchRows, connection->getTimeZoneCache(), connection->getMemoryAccount(),
+                                        connection->getClientGate());
+        setResultSet(results);
+        prefetcher = (PrefetchResultSet*)results;
+    } else {
+        setResultSet(results);
+    }
 
     return resultSet;
 }
@@ -1019,6 +1899,7 @@ RETCODE OdbcStatement::sqlBindParameter(SQLUSMALLINT parameter,
         case SQL_C_TYPE_TIMESTAMP:
         case SQL_C_NUMERIC:
         // case SQL_C_GUID:
+        case SQL_C_NUODB_FILE:
         case SQL_C_DEFAULT:
             break;
 
@@ -1085,6 +1966,11 @@ RETCODE OdbcStatement::sqlBindParameter(SQLUSMALLINT parameter,
             binding->bufferLength = bufferLength;
     }
 
+    // the buffer of a file reference holds its path, whatever the column
+    if (cType == SQL_C_NUODB_FILE) {
+        binding->bufferLength = bufferLength;
+    }
+
     TRACE(formatString("bindparam %d, columnsize, %d bufsize %d, hasDataExec %s, binding buf length %d", parameter, columnSize, bufferLength, hasDataAtExec ? "true" : "false", binding->bufferLength).c_str());
 
     return sqlSuccess();
@@ -1102,6 +1988,15 @@ bool OdbcStatement::checkParameterSize(Binding* binding, int parameter, SQLLEN e
     }
 }
 
+bool OdbcStatement::chargeOrFail(BindingState* state, size_t bytes)
+{
+    if (!state->memory.set(bytes)) {
+        postError(new OdbcError(0, "HY001", "Memory allocation error: the connection's MemoryLimit is reached"));
+        return false;
+    }
+    return true;
+}
+
 RETCODE OdbcStatement::setParameter(Binding* binding, int parameter)
 {
     clearErrors();
@@ -1135,23 +2030,80 @@ RETCODE OdbcStatement::setParameter(Binding* binding, int paramId, PTR pointer,
             case SQL_C_CHAR: {
                 // since we append here, we need to force a reset sometimes
                 std::string_view strToAppend((const char*)pointer, length == SQL_NTS ? strlen((const char*)pointer) : length);
+                BindingState* state = parameters.getState(paramId);
+                std::string& accumulator = state->accumulator;
+                if (binding->sqlType == SQL_BINARY || binding->sqlType == SQL_VARBINARY || binding->sqlType == SQL_LONGVARBINARY) {
+                    // hex digits, decoded as they come: a digit left at the
+                    // end of one piece is paired with the start of the next
+                    if (forceReset) {
+                        accumulator.clear();
+                        state->hexDigit = 0;
+                    }
+                    size_t digits = strToAppend.size() + (state->hexDigit ? 1 : 0);
+                    if (!chargeOrFail(state, accumulator.size() + digits / 2)) {
+                        return SQL_ERROR;
+                    }
+                    size_t   size = accumulator.size();
+                    accumulator.resize(size + digits / 2);
+                    uint8_t* out = (uint8_t*)&accumulator[size];
+                    bool     valid = true;
+                    if (state->hexDigit && !strToAppend.empty()) {
+                        char pair[2] = { state->hexDigit, strToAppend[0] };
+                        valid = HexCodec::decode(pair, 2, out++);
+                        strToAppend.remove_prefix(1);
+                        state->hexDigit = 0;
+                    }
+                    if (strToAppend.size() % 2) {
+                        state->hexDigit = strToAppend.back();
+                        strToAppend.remove_suffix(1);
+                    }
+                    if (!valid || !HexCodec::decode(strToAppend.data(), strToAppend.size(), out) || (forceReset && binding->dataAtExecLength == 0 && state->hexDigit)) {
+                        return sqlReturn(SQL_ERROR, "22018", "Invalid character value for cast specification: expected pairs of hex digits");
+                    }
+                    statement->setBytes(paramId, (int)accumulator.size(), accumulator.c_str());
+                    break;
+                }
+                if (!chargeOrFail(state, (forceReset ? 0 : accumulator.size()) + strToAppend.size())) {
+                    return SQL_ERROR;
+                }
                 if (forceReset) {
-                    binding->accumulator = strToAppend;
+                    accumulator = strToAppend;
                 } else {
-                    binding->accumulator += strToAppend;
+                    accumulator += strToAppend;
                 }
-                statement->setString(paramId, binding->accumulator.c_str(), binding->accumulator.size());
+                statement->setString(paramId, accumulator.c_str(), accumulator.size());
                 break;
             }
 
             case SQL_C_BINARY: {
                 std::string_view strToAppend((const char*)pointer, length);
+                BindingState* state = parameters.getState(paramId);
+                std::string& accumulator = state->accumulator;
+                if (!chargeOrFail(state, (forceReset ? 0 : accumulator.size()) + strToAppend.size())) {
+                    return SQL_ERROR;
+                }
                 if (forceReset) {
-                    binding->accumulator = strToAppend;
+                    accumulator = strToAppend;
                 } else {
-                    binding->accumulator += strToAppend;
+                    accumulator += strToAppend;
+                }
+                statement->setBytes(paramId, (int)accumulator.size(), accumulator.c_str());
+                break;
+            }
+
+            case SQL_C_NUODB_FILE: {
+                // the contents of the file, mapped rather than read
+                std::string path((const char*)pointer, length == SQL_NTS ? strlen((const char*)pointer) : strnlen((const char*)pointer, length));
+                MappedFile& file = parameters.getState(paramId)->file;
+                if (!file.open(path.c_str())) {
+                    postError("HY000", formatString("Cannot read %s: %s", path.c_str(), strerror(errno)));
+                    return SQL_ERROR;
+                }
+                if (binding->sqlType == SQL_BINARY || binding->sqlType == SQL_VARBINARY || binding->sqlType == SQL_LONGVARBINARY) {
+                    statement->setBytes(paramId, (int)file.getLength(), file.getData());
+                } else {
+                    statement->setString(paramId, file.getData(), (int)file.getLength());
                 }
-                statement->setBytes(paramId, (int)binding->accumulator.size(), binding->accumulator.c_str());
                 break;
             }
 
@@ -1210,11 +2162,23 @@ RETCODE OdbcStatement::setParameter(Binding* binding, int paramId, PTR pointer,
                 break;
             }
 
+            case SQL_C_NUMERIC: {
+                SQL_NUMERIC_STRUCT* numeric = (SQL_NUMERIC_STRUCT*)pointer;
+                int precision;
+                int scale;
+                if (!applicationParamDescriptor->getPrecisionAndScale(paramId, &precision, &scale)) {
+                    scale = numeric->scale;
+                }
+                std::string text;
+                Numeric::toString(numeric, scale, text);
+                statement->setString(paramId, text.c_str());
+                break;
+            }
+
             case SQL_C_BIT:
 
             // case SQL_C_BOOKMARK:
             // case SQL_C_VARBOOKMARK:
-            case SQL_C_NUMERIC:
             // case SQL_C_GUID:
             // break;
 
@@ -1229,10 +2193,15 @@ RETCODE OdbcStatement::setParameter(Binding* binding, int paramId, PTR pointer,
     return SQL_SUCCESS;
 }
 
+// From another thread, a fetch waiting for a prefetched batch is woken and
+// fails; the producer stops once the row it's reading has arrived.
 RETCODE OdbcStatement::sqlCancel()
 {
     clearErrors();
     cancel = true;
+    if (prefetcher) {
+        prefetcher->cancel();
+    }
 
     return sqlSuccess();
 }
@@ -1274,7 +2243,7 @@ RETCODE OdbcStatement::sqlProcedureColumns(SQLCHAR* catalog, SQLSMALLINT catLeng
     try {
         DatabaseMetaData* dbMetaData = connection->getMetaData();
         auto rSet = new ResultSetMapper(dbMetaData->getProcedureColumns(cat, scheme, procedures, columns), new OdbcTypeMapper());
-        setResultSet(rSet);
+        setResultSet(rSet, true);
     } catch (SQLException& exception) {
         postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
         return SQL_ERROR;
@@ -1321,7 +2290,19 @@ RETCODE OdbcStatement::sqlGetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             break;
 
         case SQL_ATTR_CURSOR_TYPE:
-            value = SQL_CURSOR_FORWARD_ONLY;
+            value = cursorType;
+            break;
+
+        case SQL_ATTR_CURSOR_SCROLLABLE:
+            value = cursorType == SQL_CURSOR_FORWARD_ONLY ? SQL_NONSCROLLABLE : SQL_SCROLLABLE;
+            break;
+
+        case SQL_ATTR_NUODB_CURSOR_MEMORY:
+            value = cursorMemory;
+            break;
+
+        case SQL_ATTR_KEYSET_SIZE:
+            value = keysetSize;
             break;
 
         case SQL_CONCURRENCY:
@@ -1329,7 +2310,7 @@ RETCODE OdbcStatement::sqlGetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             break;
 
         case SQL_ATTR_MAX_LENGTH:
-            value = 0;
+            value = maxLength;
             break;
 
         case SQL_ATTR_MAX_ROWS:
@@ -1337,7 +2318,7 @@ RETCODE OdbcStatement::sqlGetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             break;
 
         case SQL_ATTR_ROW_NUMBER:
-            value = (SQLULEN)rowCountPerFetch;
+            value = scroller && rowCountPerFetch > 0 ? rowsetStart + rowPosition : (SQLULEN)rowCountPerFetch;
             break;
 
         case SQL_ATTR_ROW_BIND_TYPE:
@@ -1352,13 +2333,27 @@ RETCODE OdbcStatement::sqlGetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             value = (SQLULEN)queryTimeoutSeconds;
             break;
 
+        case SQL_ATTR_NUODB_PREFETCH:
+            value = (SQLULEN)prefetchRows;
+            break;
+
+        case SQL_ATTR_NUODB_PARALLEL_FETCH:
+            value = (SQLULEN)parallelFetchRows;
+            break;
+
+        case SQL_ATTR_NUODB_FETCH_SIZE:
+            value = fetchSize;
+            break;
+
+        case SQL_ATTR_RETRIEVE_DATA:
+            value = retrieveData ? SQL_RD_ON : SQL_RD_OFF;
+            break;
+
         /***
             case SQL_ATTR_ASYNC_ENABLE              4
             case SQL_ATTR_CONCURRENCY               SQL_CONCURRENCY 7
-            case SQL_ATTR_CURSOR_TYPE               SQL_CURSOR_TYPE
             case    SQL_ATTR_ENABLE_AUTO_IPD            15
             case SQL_ATTR_FETCH_BOOKMARK_PTR            16
-            case SQL_ATTR_KEYSET_SIZE               SQL_KEYSET_SIZE
             case SQL_ATTR_NOSCAN                        SQL_NOSCAN
             case SQL_ATTR_PARAM_BIND_OFFSET_PTR     17
             case    SQL_ATTR_PARAM_BIND_TYPE            18
@@ -1366,7 +2361,6 @@ RETCODE OdbcStatement::sqlGetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             case SQL_ATTR_PARAM_STATUS_PTR          20
             case    SQL_ATTR_PARAMS_PROCESSED_PTR       21
             case    SQL_ATTR_PARAMSET_SIZE              22
-            case SQL_ATTR_RETRIEVE_DATA             SQL_RETRIEVE_DATA
             case SQL_ATTR_ROW_BIND_OFFSET_PTR       23
 
             case SQL_ATTR_ROW_NUMBER                    SQL_ROW_NUMBER
@@ -1489,6 +2483,17 @@ RETCODE OdbcStatement::executeStatement()
 
 RETCODE OdbcStatement::doExecuteStatement()
 {
+    // the server stops at SQL_ATTR_MAX_ROWS rather than the driver
+    statement->setMaxRows((int)std::min<SQLULEN>(maxRowsPerSelect, INT_MAX));
+
+    // rows per round trip: a rowset unless set otherwise, where a rowset
+    // of one is left to the client
+    if (fetchSize == SQL_NUODB_FETCH_ADAPTIVE) {
+        statement->setFetchSize(adaptiveFetch.getSize(rowArraySize));
+    } else if (fetchSize > 0 || rowArraySize > 1) {
+        statement->setFetchSize((int)std::min<SQLULEN>(fetchSize > 0 ? fetchSize : rowArraySize, INT_MAX));
+    }
+
     if (callableStatement) {
         for (int n = 1; n <= parameters.getCount(); ++n) {
             Binding* binding = parameters.getBinding(n);
@@ -1505,11 +2510,14 @@ RETCODE OdbcStatement::doExecuteStatement()
         for (int n = 1; n <= parameters.getCount(); ++n) {
             Binding* binding = parameters.getBinding(n);
             if (binding->pointer && binding->type != SQL_PARAM_INPUT) {
-                setValue(binding, n, false);
+                setValue(resultSet, binding, n, false);
             }
         }
     }
 
+    // the client has the parameters' values now; the driver's copies go
+    parameters.reset();
+
     rowCount = statement->getUpdateCount();
     if (hasRset) {
         getResultSet();
@@ -1532,7 +2540,7 @@ RETCODE OdbcStatement::sqlGetTypeInfo(SQLSMALLINT dataType)
         } else {
             mapper = new ResultSetMapper(dbMetaData->getTypeInfo(), omap);
         }
-        setResultSet(mapper);
+        setResultSet(mapper, true);
     } catch (SQLException& exception) {
         postError(NuoDB::NuoDBSqlConstants::nuoDBCodeToSQLSTATE(exception.getSqlcode()), exception);
         return SQL_ERROR;
@@ -1584,6 +2592,10 @@ RETCODE OdbcStatement::sqlParamData(SQLPOINTER* ptr)
             Binding* binding = parameters.getBinding(currentPutDataParam);
 
             if (binding->dataAtExecLength == 0) {
+                // a binary parameter's hex digits have to pair up
+                if (binding->count > 0 && parameters.getState(currentPutDataParam)->hexDigit) {
+                    return sqlReturn(SQL_ERROR, "22018", "Invalid character value for cast specification: expected pairs of hex digits");
+                }
                 currentPutDataParam++;
             } else {
                 *ptr = binding->pointer;
@@ -1624,12 +2636,18 @@ RETCODE OdbcStatement::sqlSetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             maxRowsPerSelect = (SQLULEN)ptr;
             break;
 
+        case SQL_ATTR_MAX_LENGTH:
+            maxLength = (SQLULEN)ptr;
+            fetchPlan.invalidate();
+            break;
+
         case SQL_ATTR_ROW_ARRAY_SIZE:
             rowArraySize = (SQLULEN)ptr;
             break;
 
         case SQL_ATTR_ROW_BIND_TYPE:
             rowSize = (SQLULEN)ptr;
+            fetchPlan.invalidate();
             break;
 
         case SQL_ATTR_QUERY_TIMEOUT: {
@@ -1638,21 +2656,60 @@ RETCODE OdbcStatement::sqlSetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             break;
         }
 
+        case SQL_ATTR_NUODB_PREFETCH:
+            prefetchRows = (int)(SQLULEN)ptr;
+            break;
+
+        case SQL_ATTR_NUODB_PARALLEL_FETCH:
+            parallelFetchRows = (int)(SQLULEN)ptr;
+            break;
+
+        case SQL_ATTR_NUODB_FETCH_SIZE:
+            fetchSize = (SQLULEN)ptr;
+            break;
+
+        case SQL_ATTR_RETRIEVE_DATA: {
+            SQLULEN retrieve = (SQLULEN)ptr;
+            if (retrieve != SQL_RD_ON && retrieve != SQL_RD_OFF) {
+                return sqlReturn(SQL_ERROR, "HY024", "Invalid attribute value");
+            }
+            retrieveData = retrieve == SQL_RD_ON;
+            break;
+        }
+
         // Some statement attributes support substitution of a similar value if the data source does not support
         // the value specified in ValuePtr. In such cases, the driver returns SQL_SUCCESS_WITH_INFO and SQLSTATE
         // 01S02 (Option value changed). For example, if Attribute is SQL_ATTR_CONCURRENCY and ValuePtr is
         // SQL_CONCUR_ROWVER, and if the data source does not support this, the driver substitutes SQL_CONCUR_VALUES
         // and returns SQL_SUCCESS_WITH_INFO. To determine the substituted value, an application calls SQLGetStmtAttr.
         case SQL_ATTR_CURSOR_TYPE: {
-            SQLULEN cursorType = (SQLULEN)ptr;
-            if (cursorType != SQL_CURSOR_FORWARD_ONLY) {
+            SQLULEN type = (SQLULEN)ptr;
+            if (type != SQL_CURSOR_FORWARD_ONLY && type != SQL_CURSOR_STATIC && type != SQL_CURSOR_KEYSET_DRIVEN) {
+                cursorType = SQL_CURSOR_KEYSET_DRIVEN;
                 std::ostringstream msg;
-                msg << "Optional feature not implemented: set statement attribute SQL_ATTR_CURSOR_TYPE type " << (long)cursorType << ", only SQL_CURSOR_FORWARD_ONLY is supported";
+                msg << "Optional feature not implemented: set statement attribute SQL_ATTR_CURSOR_TYPE type " << (long)type << ", SQL_CURSOR_KEYSET_DRIVEN is used instead";
                 return sqlReturn(SQL_SUCCESS_WITH_INFO, "01S02", msg.str().c_str());
             }
+            cursorType = type;
             break;
         }
 
+        case SQL_ATTR_CURSOR_SCROLLABLE:
+            if ((SQLULEN)ptr == SQL_NONSCROLLABLE) {
+                cursorType = SQL_CURSOR_FORWARD_ONLY;
+            } else if (cursorType == SQL_CURSOR_FORWARD_ONLY) {
+                cursorType = SQL_CURSOR_STATIC;
+            }
+            break;
+
+        case SQL_ATTR_NUODB_CURSOR_MEMORY:
+            cursorMemory = (SQLULEN)ptr;
+            break;
+
+        case SQL_ATTR_KEYSET_SIZE:
+            keysetSize = (SQLULEN)ptr;
+            break;
+
         case SQL_ATTR_CONCURRENCY: {
             SQLULEN concurrenceType = (SQLULEN)ptr;
             if (concurrenceType != SQL_CONCUR_READ_ONLY) {
@@ -1671,15 +2728,12 @@ RETCODE OdbcStatement::sqlSetStmtAttr(SQLINTEGER attribute, SQLPOINTER ptr, SQLI
             case SQL_ATTR_ASYNC_ENABLE              4
             case SQL_ATTR_ENABLE_AUTO_IPD           15
             case SQL_ATTR_FETCH_BOOKMARK_PTR            16
-            case SQL_ATTR_KEYSET_SIZE               SQL_KEYSET_SIZE
-            case SQL_ATTR_MAX_LENGTH                    SQL_MAX_LENGTH
             case SQL_ATTR_PARAM_BIND_OFFSET_PTR     17
             case SQL_ATTR_PARAM_BIND_TYPE           18
             case SQL_ATTR_PARAM_OPERATION_PTR       19
             case SQL_ATTR_PARAM_STATUS_PTR          20
             case SQL_ATTR_PARAMS_PROCESSED_PTR      21
             case SQL_ATTR_PARAMSET_SIZE             22
-            case SQL_ATTR_RETRIEVE_DATA             SQL_RETRIEVE_DATA
             case SQL_ATTR_ROW_BIND_OFFSET_PTR       23
             case SQL_ATTR_ROW_BIND_TYPE             SQL_BIND_TYPE
             case SQL_ATTR_ROW_NUMBER                    SQL_ROW_NUMBER
@@ -1752,25 +2806,22 @@ RETCODE OdbcStatement::sqlColAttributes(SQLUSMALLINT column, SQLUSMALLINT descTy
                 value = metaData->getColumnCount();
                 break;
 
-            case SQL_COLUMN_TYPE: {
-                // If we have string/char/varchar types and the display size has not been set,
-                // then return LONGVARCHAR
-                value = (SQLLEN)OdbcTypeMapper::mapType(metaData->getColumnType(column));
-                if ((value == (int32_t)NUOSQL_CHAR || value == (int32_t)NUOSQL_VARCHAR)
-                    && ( metaData->getCurrentColumnMaxLength(column) == 0)) {
-                    value = (int32_t)NUOSQL_LONGVARCHAR;
-                }
+            case SQL_COLUMN_TYPE:
+                // string/char/varchar types of no known length are LONGVARCHAR
+                value = columnSizes.get(connection->getMetaData(), metaData, column).sqlType;
                 break;
-            }
 
             case SQL_COLUMN_LENGTH:
             case SQL_DESC_OCTET_LENGTH:
+                value = columnSizes.get(connection->getMetaData(), metaData, column).octetLength;
+                break;
+
             case SQL_COLUMN_DISPLAY_SIZE:
-                value = metaData->getCurrentColumnMaxLength(column);
+                value = columnSizes.get(connection->getMetaData(), metaData, column).displaySize;
                 break;
 
             case SQL_COLUMN_PRECISION:
-                value = metaData->getPrecision(column);
+                value = (SQLLEN)columnSizes.get(connection->getMetaData(), metaData, column).columnSize;
                 break;
 
             case SQL_COLUMN_SCALE:
@@ -1875,20 +2926,21 @@ RETCODE OdbcStatement::sqlColAttribute(SQLUSMALLINT column,
 
             case SQL_DESC_TYPE:
             case SQL_DESC_CONCISE_TYPE:
-                // If we have string/char/varchar types and the display size has not been set,
-                // then return LONGVARCHAR
-                value = (SQLLEN)OdbcTypeMapper::mapType(metaData->getColumnType(column));
-                if ((value == (int32_t)NUOSQL_CHAR || value == (int32_t)NUOSQL_VARCHAR)
-                    && ( metaData->getCurrentColumnMaxLength(column) == 0)) {
-                    value = (int32_t)NUOSQL_LONGVARCHAR;
-                }
+                // string/char/varchar types of no known length are LONGVARCHAR
+                value = columnSizes.get(connection->getMetaData(), metaData, column).sqlType;
                 break;
 
-            case SQL_COLUMN_LENGTH:
             case SQL_DESC_LENGTH:
+                value = columnSizes.get(connection->getMetaData(), metaData, column).length;
+                break;
+
+            case SQL_COLUMN_LENGTH:
             case SQL_DESC_OCTET_LENGTH:
+                value = columnSizes.get(connection->getMetaData(), metaData, column).octetLength;
+                break;
+
             case SQL_DESC_DISPLAY_SIZE:
-                value = metaData->getCurrentColumnMaxLength(column);
+                value = columnSizes.get(connection->getMetaData(), metaData, column).displaySize;
                 break;
 
             case SQL_COLUMN_PRECISION:
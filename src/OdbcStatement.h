@@ -8,10 +8,16 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "OdbcBase.h"
 #include "OdbcObject.h"
+#include "AdaptiveFetchSize.h"
 #include "Bindings.h"
+#include "ColumnSizes.h"
+#include "FetchPlan.h"
+#include "NuoODBCAttributes.h"
+#include "NuoODBCFile.h"
 
 namespace NuoDB {
 class CallableStatement;
@@ -20,9 +26,16 @@ class ResultSet;
 class ResultSetMetaData;
 }
 
+struct ArrowArray;
+struct ArrowSchema;
+struct NuoODBCExportOptions;
+
+class ClientGate;
 class OdbcConnection;
 class OdbcDesc;
+class PrefetchResultSet;
 class RemPreparedStatement;
+class ScrollableResultSet;
 
 class OdbcStatement : public OdbcObject
 {
@@ -78,10 +91,17 @@ public:
     RETCODE                 sqlPrimaryKeys(SQLCHAR* catalog, SQLSMALLINT catLength, SQLCHAR* schema, SQLSMALLINT schemaLength, SQLCHAR* table, SQLSMALLINT tableLength);
     RETCODE                 sqlStatistics(SQLCHAR* catalog, SQLSMALLINT catLength, SQLCHAR* schema, SQLSMALLINT schemaLength, SQLCHAR* table, SQLSMALLINT tableLength, SQLUSMALLINT unique, SQLUSMALLINT reservedSic);
     RETCODE                 sqlFreeStmt(SQLUSMALLINT option);
-    int                     setValue(Binding* binding, int column, bool indicatorIsRemaining, SQLULEN rowIndex=0, SQLULEN rowSize=SQL_BIND_BY_COLUMN);
+    int                     setValue(NuoDB::ResultSet* results, Binding* binding, int column, bool indicatorIsRemaining, BindingState* state = nullptr);
     RETCODE                 sqlFetch();
+    RETCODE                 sqlFetchScroll(SQLSMALLINT orientation, SQLLEN offset);
+    RETCODE                 sqlExtendedFetch(SQLUSMALLINT orientation, SQLLEN offset, SQLULEN* rowCountPtr, SQLUSMALLINT* rowStatusArray);
+    RETCODE                 sqlFetchArrow(SQLULEN batchRows, ArrowSchema* schema, ArrowArray* batch);
+    RETCODE                 sqlExport(int fd, const NuoODBCExportOptions* options, SQLLEN* rowCount);
+    RETCODE                 sqlSetPos(SQLSETPOSIROW row, SQLUSMALLINT operation, SQLUSMALLINT lockType);
     RETCODE                 sqlBindCol(SQLUSMALLINT columnNumber, SQLSMALLINT targetType, SQLPOINTER targetValuePtr, SQLLEN bufferLength, SQLLEN* indPtr);
-    void                    setResultSet(NuoDB::ResultSet* results);
+    void                    setResultSet(NuoDB::ResultSet* results, bool owned = false);
+    void                    invalidateFetchPlan() { fetchPlan.invalidate(); }
+    ClientGate*             getClientGate();
     void                    releaseResultSet();
     void                    releaseStatement();
     RETCODE                 sqlPrepare(SQLCHAR* sql, SQLINTEGER sqlLength);
@@ -93,6 +113,16 @@ public:
 
 private:
     bool checkParameterSize(Binding* binding, int parameter, SQLLEN expectedSize);
+    // Charge the bytes state holds to the connection; false, with HY001
+    // posted, if that would pass its MemoryLimit.
+    bool chargeOrFail(BindingState* state, size_t bytes);
+    bool isStreamedClob(NuoDB::ResultSet* results, int column, BindingState* state);
+    RETCODE fetchRowset();
+    RETCODE fetchForward();
+    RETCODE fetchCanceled(RETCODE ret);
+    RETCODE fetchBlock(bool parallel);
+    void closeAtMaxRows();
+    std::vector<int> getUnboundColumns() const;
 
     std::string     sqlStmt;
 
@@ -106,23 +136,41 @@ private:
     NuoDB::PreparedStatement* statement = nullptr;
     NuoDB::CallableStatement* callableStatement = nullptr;
     NuoDB::ResultSetMetaData* metaData = nullptr;
+    PrefetchResultSet*        prefetcher = nullptr;
+    ScrollableResultSet*      scroller = nullptr;   // the result set of a scrollable cursor
+    NuoDB::ResultSet*         ownedResults = nullptr;   // made by the driver, and released with the cursor
 
     void*         paramBindOffset = nullptr;
     Bindings      fetchBindings;
     Bindings      parameters;
     Bindings      getDataBindings;
+    ColumnSizes   columnSizes;            // of the columns of metaData
+    FetchPlan     fetchPlan;
+    AdaptiveFetchSize adaptiveFetch;
+    StagedRowset  rowset;                 // the unbound columns of a block cursor's rowset, for SQLGetData
+    SQLULEN       rowPosition = 0;        // the row of the rowset SQLGetData reads, set by SQLSetPos
     SQLLEN        rowCount = -1;
     SQLULEN       bindType = 0;
     SQLULEN       rowCountPerFetch = 0;   // number of rows that we have fetched in this SQLFetch call
     SQLULEN*      rowCountPerFetchPtr = nullptr; // optional pointer that user uses to keep track of number of rows fetched per SQLFetch
     SQLULEN       rowCountPerSelect = 0;  // number of rows that we have fetched in this select statement
     SQLULEN       maxRowsPerSelect = 0;   // max # of rows to fetch per select like an sql limit
+    SQLULEN       maxLength = 0;          // SQL_ATTR_MAX_LENGTH: max bytes returned for a character or binary value
     SQLUSMALLINT* rowStatusPtr = nullptr; // an array used to maintain a status of a fetched row when fetching rows in groups
     SQLULEN       rowArraySize = 1;
+    SQLULEN       cursorType = SQL_CURSOR_FORWARD_ONLY;
+    SQLULEN       cursorMemory;
+    SQLULEN       keysetSize = 0;
+    SQLULEN       fetchSize;              // SQL_ATTR_NUODB_FETCH_SIZE
+    SQLULEN       rowsetStart = 0;        // scrollable cursor: the first row of the rowset, 0 before the first row
+    SQLULEN       rowsetSize = 0;         // scrollable cursor: the rowset size of the last fetch
     SQLULEN       rowSize = SQL_BIND_BY_COLUMN;
     int           numberColumns = 0;
     int           currentPutDataParam = 0;
     int           queryTimeoutSeconds = 0;
+    int           prefetchRows = 0;
+    int           parallelFetchRows = 0;
+    bool          retrieveData = true;    // SQL_ATTR_RETRIEVE_DATA: SQL_RD_OFF moves the cursor without reading values
     bool          eof = false;
     bool          cancel = false;
     bool          returnedGeneratedKeys = false;
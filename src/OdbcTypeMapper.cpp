@@ -40,3 +40,9 @@ NuoDB::SqlType OdbcTypeMapper::mapType(int in)
             return (NuoDB::SqlType)in;
     }
 }
+
+// static
+bool OdbcTypeMapper::isInlineBinary(int in)
+{
+    return in == (int)NuoDB::NUOSQL_BINARY || in == (int)NuoDB::NUOSQL_VARBINARY;
+}
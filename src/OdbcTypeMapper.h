@@ -28,4 +28,8 @@ public:
     virtual int64_t getLong(int64_t value);
 
     static NuoDB::SqlType mapType(int in);
+
+    // Whether values of type in (a NuoDB type) come with the row, as
+    // opposed to LOBs, which are read through a Blob or Clob.
+    static bool isInlineBinary(int in);
 };
@@ -0,0 +1,245 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include "PrefetchResultSet.h"
+
+#include "NuoRemote/ResultSetMetaData.h"
+
+using namespace NuoDB;
+
+// Never stage more than this many batches ahead of the application.
+#define MAX_STAGED_BATCHES 2
+
+PrefetchResultSet::PrefetchResultSet(ResultSet* b, int rows, TimeZoneCache* zone, MemoryAccount* memory, ClientGate* clientGate)
+    : StagedResultSet(b->getMetaData(), zone),
+      base(b),
+      batchRows(rows > 0 ? rows : 1),
+      account(memory),
+      gate(clientGate)
+{
+    start();
+}
+
+PrefetchResultSet::PrefetchResultSet(ResultSet* b, const std::vector<StagedKind>& kinds, int rows, TimeZoneCache* zone,
+                                     MemoryAccount* memory, ClientGate* clientGate)
+    : StagedResultSet(b->getMetaData(), zone, kinds),
+      base(b),
+      batchRows(rows > 0 ? rows : 1),
+      account(memory),
+      gate(clientGate)
+{
+    start();
+}
+
+void PrefetchResultSet::start()
+{
+    base->addRef();
+
+    producer = std::thread(&PrefetchResultSet::produce, this);
+}
+
+PrefetchResultSet::~PrefetchResultSet()
+{
+    stop();
+    releaseBatch(current);
+    for (auto& batch : staged) {
+        releaseBatch(batch);
+    }
+    base->release();
+}
+
+bool PrefetchResultSet::canPrefetch(ResultSet* base)
+{
+    return canStage(base->getMetaData());
+}
+
+void PrefetchResultSet::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    if (gate) {
+        gate->wake();
+    }
+}
+
+// Called within an application call, when the producer can only be
+// waiting for its turn or for room: it sees stopping straight away.
+void PrefetchResultSet::stop()
+{
+    if (producer.joinable()) {
+        cancel();
+        producer.join();
+    }
+}
+
+// Read the next row of base into batch, in the producer's turn on the
+// connection; false at the end of the rows, or once stopping.
+bool PrefetchResultSet::readRow(Batch& batch)
+{
+    if (gate ? !gate->enterProducer(stopping) : stopping.load()) {
+        return false;
+    }
+
+    StagedRow row;
+    bool      read = false;
+    try {
+        read = base->next();
+        if (read) {
+            stageRow(base, row);
+        }
+    } catch (...) {
+        releaseRow(row);
+        if (gate) {
+            gate->leaveProducer();
+        }
+        throw;
+    }
+    if (gate) {
+        gate->leaveProducer();
+    }
+
+    if (read) {
+        batch.push_back(std::move(row));
+    }
+    return read;
+}
+
+void PrefetchResultSet::produce()
+{
+    for (;;) {
+        Batch              batch;
+        std::exception_ptr failure;
+
+        // Stage outside the lock; an error ends the batch so the rows read
+        // before it still reach the application.
+        batch.reserve(batchRows);
+        try {
+            while ((int)batch.size() < batchRows) {
+                if (!readRow(batch)) {
+                    break;
+                }
+            }
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        if (account) {
+            size_t bytes = 0;
+            for (auto& row : batch) {
+                bytes += getSize(row);
+            }
+            account->charge(MemoryUse::Prefetch, bytes, true);
+        }
+
+        bool last = failure || (int)batch.size() < batchRows;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return stopping || staged.size() < MAX_STAGED_BATCHES; });
+
+        if (stopping) {
+            lock.unlock();
+            releaseBatch(batch);
+            return;
+        }
+
+        if (!batch.empty()) {
+            staged.push_back(std::move(batch));
+        }
+        error = failure;
+        done = last;
+        lock.unlock();
+        changed.notify_all();
+
+        if (last) {
+            return;
+        }
+    }
+}
+
+void PrefetchResultSet::releaseBatch(Batch& batch)
+{
+    size_t bytes = 0;
+    for (auto& row : batch) {
+        bytes += getSize(row);
+        releaseRow(row);
+    }
+    if (account) {
+        account->credit(MemoryUse::Prefetch, bytes);
+    }
+    batch.clear();
+}
+
+void PrefetchResultSet::addRef()
+{
+    ++useCount;
+}
+
+int PrefetchResultSet::release()
+{
+    if (--useCount == 0) {
+        delete this;
+
+        return 0;
+    }
+
+    return useCount;
+}
+
+void PrefetchResultSet::close()
+{
+    stop();
+    base->close();
+}
+
+bool PrefetchResultSet::next()
+{
+    if (++currentRow < current.size()) {
+        setRow(&current[currentRow]);
+        return true;
+    }
+
+    setRow(nullptr);
+    releaseBatch(current);
+    currentRow = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [this] { return !staged.empty() || done || stopping; };
+    if (!ready()) {
+        // the producer can't read while this call holds the connection, so
+        // the call lets go of it while it waits
+        if (gate) {
+            lock.unlock();
+            gate->leave();
+            lock.lock();
+        }
+        changed.wait(lock, ready);
+        if (gate) {
+            lock.unlock();
+            gate->enter();
+            lock.lock();
+        }
+    }
+
+    if (staged.empty()) {
+        if (error) {
+            std::exception_ptr pending = error;
+            error = nullptr;
+            std::rethrow_exception(pending);
+        }
+        return false;
+    }
+
+    current = std::move(staged.front());
+    staged.pop_front();
+    lock.unlock();
+    changed.notify_all();
+
+    setRow(&current[0]);
+    return true;
+}
@@ -0,0 +1,89 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ClientGate.h"
+#include "StagedResultSet.h"
+
+/**
+ * A result set that reads ahead of the application.  A producer thread
+ * drives next() on the base result set and stages whole batches of rows
+ * while the application consumes the current batch; at most two batches
+ * are staged at any time.  Errors hit by the producer are rethrown by
+ * next() once the rows before them have been consumed.
+ *
+ * Only result sets whose columns can all be staged (numeric, character,
+ * and date/time types) can be prefetched; see canPrefetch().
+ *
+ * Staged batches are charged to account, if there is one, regardless of
+ * its limit: there are never more than two of them.
+ *
+ * The producer takes turns on the connection with the application through
+ * gate, if there is one, reading a row at a time, so next() has to be
+ * called within an application call on the gate.  cancel() stops the
+ * producer from another thread without waiting for it.
+ */
+class PrefetchResultSet : public StagedResultSet
+{
+public:
+    PrefetchResultSet(NuoDB::ResultSet* base, int batchRows, TimeZoneCache* timeZone, MemoryAccount* account = nullptr,
+                      ClientGate* gate = nullptr);
+
+    // With the kinds of base's columns given rather than found from its
+    // metadata.
+    PrefetchResultSet(NuoDB::ResultSet* base, const std::vector<StagedKind>& kinds, int batchRows, TimeZoneCache* timeZone,
+                      MemoryAccount* account = nullptr, ClientGate* gate = nullptr);
+    virtual ~PrefetchResultSet();
+
+    static bool canPrefetch(NuoDB::ResultSet* base);
+
+    virtual void addRef();
+    virtual int  release();
+    virtual void close();
+    virtual bool next();
+
+    // Stop reading ahead, and have a next() that's waiting for rows return
+    // false once the rows already staged are gone.
+    void         cancel();
+
+private:
+    typedef std::vector<StagedRow> Batch;
+
+    void         start();
+    void         produce();
+    bool         readRow(Batch& batch);
+    void         releaseBatch(Batch& batch);
+    void         stop();
+
+    NuoDB::ResultSet*         base;
+    int                       batchRows;
+    MemoryAccount*            account;
+    ClientGate*               gate;
+    int                       useCount = 1;
+
+    // shared with the producer
+    std::mutex                mutex;
+    std::condition_variable   changed;
+    std::deque<Batch>         staged;
+    std::exception_ptr        error;
+    bool                      done = false;
+    std::atomic<bool>         stopping { false };
+    std::thread               producer;
+
+    // consumer only
+    Batch                     current;
+    size_t                    currentRow = 0;
+};
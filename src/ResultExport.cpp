@@ -0,0 +1,756 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+
+#ifdef _WIN32
+# include <io.h>
+#else
+# include <sys/uio.h>
+# include <unistd.h>
+#endif
+
+#include "ResultExport.h"
+
+#include "OdbcBase.h"
+#include "OdbcTypeMapper.h"
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/Clob.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/ResultSetMetaData.h"
+
+// The most pieces handed to one writev.
+#if defined(IOV_MAX) && IOV_MAX < 1024
+# define RESULT_EXPORT_IOVECS IOV_MAX
+#else
+# define RESULT_EXPORT_IOVECS 1024
+#endif
+
+// Arrow IPC: the continuation marker that starts each message, the
+// metadata version (V5), and the message header types.
+#define ARROW_IPC_CONTINUATION  0xFFFFFFFF
+#define ARROW_IPC_VERSION       4
+#define ARROW_IPC_SCHEMA        1
+#define ARROW_IPC_RECORD_BATCH  3
+
+using namespace NuoDB;
+
+void OutputFile::queue(const void* data, size_t length)
+{
+    if (length > 0) {
+        pieces.push_back({ data, length });
+        queued += length;
+    }
+}
+
+bool OutputFile::flush()
+{
+    size_t next = 0;    // the first piece not written whole
+    size_t done = 0;    // the bytes of it that have been
+
+    while (next < pieces.size()) {
+#ifdef _WIN32
+        unsigned count = (unsigned)std::min<size_t>(pieces[next].length - done, INT_MAX);
+        int      written = _write(fd, (const char*)pieces[next].data + done, count);
+#else
+        struct iovec vectors[RESULT_EXPORT_IOVECS];
+        int          count = 0;
+        for (size_t n = next; n < pieces.size() && count < RESULT_EXPORT_IOVECS; ++n, ++count) {
+            size_t skip = n == next ? done : 0;
+            vectors[count].iov_base = (char*)pieces[n].data + skip;
+            vectors[count].iov_len = pieces[n].length - skip;
+        }
+        ssize_t written = writev(fd, vectors, count);
+#endif
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            error = written < 0 ? errno : EIO;
+            pieces.clear();
+            queued = 0;
+            return false;
+        }
+
+        size_t left = (size_t)written;
+        while (next < pieces.size() && left >= pieces[next].length - done) {
+            left -= pieces[next].length - done;
+            done = 0;
+            ++next;
+        }
+        done += left;
+    }
+
+    pieces.clear();
+    queued = 0;
+    return true;
+}
+
+namespace RESULT_EXPORT {
+
+using ResultExport::CsvColumn;
+using ResultExport::CsvKind;
+
+// Rows formatted into one buffer, which is written out and reused each time
+// it fills.
+class CsvWriter final
+{
+public:
+    CsvWriter(const NuoODBCExportOptions& options, OutputFile& file)
+        : output(file),
+          buffer(RESULT_EXPORT_BUFFER),
+          quoting(options.quoting),
+          delimiter(options.delimiter ? options.delimiter : ','),
+          quote(options.quote ? options.quote : '"'),
+          nullToken(options.nullToken ? options.nullToken : ""),
+          lineEnd(options.lineEnd ? options.lineEnd : "\n")
+    {
+        memset(special, 0, sizeof(special));
+        special[(unsigned char)delimiter] = true;
+        special[(unsigned char)quote] = true;
+        special[(unsigned char)'\r'] = true;
+        special[(unsigned char)'\n'] = true;
+    }
+
+    // Room for length more bytes at the end of the buffer, or nullptr if
+    // the output can't be written.
+    char* reserve(size_t length)
+    {
+        if (used + length > buffer.size()) {
+            if (!flush()) {
+                return nullptr;
+            }
+            if (length > buffer.size()) {
+                buffer.resize(length);
+            }
+        }
+        return &buffer[used];
+    }
+
+    void commit(char* end) { used = end - buffer.data(); }
+
+    bool put(const char* data, size_t length)
+    {
+        char* out = reserve(length);
+        if (!out) {
+            return false;
+        }
+        memcpy(out, data, length);
+        used += length;
+        return true;
+    }
+
+    bool putDelimiter() { return put(&delimiter, 1); }
+    bool putLineEnd() { return put(lineEnd.data(), lineEnd.size()); }
+    bool putNull() { return put(nullToken.data(), nullToken.size()); }
+
+    bool putValue(const char* value, size_t length, bool numeric)
+    {
+        if (!isQuoted(value, length, numeric)) {
+            return put(value, length);
+        }
+
+        // every quote doubled, at worst
+        char* out = reserve(2 * length + 2);
+        if (!out) {
+            return false;
+        }
+        *out++ = quote;
+        for (size_t n = 0; n < length; ++n) {
+            if (value[n] == quote) {
+                *out++ = quote;
+            }
+            *out++ = value[n];
+        }
+        *out++ = quote;
+        commit(out);
+        return true;
+    }
+
+    bool putHex(const uint8_t* value, size_t length)
+    {
+        bool  quoted = quoting == NUOODBC_QUOTE_ALL || quoting == NUOODBC_QUOTE_NONNUMERIC
+                       || (quoting == NUOODBC_QUOTE_MINIMAL && length == 0 && nullToken.empty());
+        char* out = reserve(2 * length + 2);
+        if (!out) {
+            return false;
+        }
+        if (quoted) {
+            *out++ = quote;
+        }
+        TextFormat::formatHex(value, length, out);
+        out += 2 * length;
+        if (quoted) {
+            *out++ = quote;
+        }
+        commit(out);
+        return true;
+    }
+
+    bool flush()
+    {
+        output.queue(buffer.data(), used);
+        used = 0;
+        return output.flush();
+    }
+
+private:
+    // A value that could be taken for NULL is quoted, as is one with a
+    // delimiter, a quote, or a line break in it.
+    bool isQuoted(const char* value, size_t length, bool numeric) const
+    {
+        switch (quoting) {
+            case NUOODBC_QUOTE_NONE:
+                return false;
+
+            case NUOODBC_QUOTE_ALL:
+                return true;
+
+            case NUOODBC_QUOTE_NONNUMERIC:
+                return !numeric;
+
+            default:
+                if (length == nullToken.size() && memcmp(value, nullToken.data(), length) == 0) {
+                    return true;
+                }
+                for (size_t n = 0; n < length; ++n) {
+                    if (special[(unsigned char)value[n]]) {
+                        return true;
+                    }
+                }
+                return false;
+        }
+    }
+
+    OutputFile&       output;
+    std::vector<char> buffer;
+    size_t            used = 0;
+    int               quoting;
+    char              delimiter;
+    char              quote;
+    std::string       nullToken;
+    std::string       lineEnd;
+    bool              special[256];
+};
+
+// Write the value of column of the current row of results.
+static bool writeCsvValue(CsvWriter& writer, ResultSet* results, int column, const CsvColumn& csv, TimeZoneCache* timeZone,
+                          DateTime::DayMemo* memo, std::string& scratch)
+{
+    switch (csv.kind) {
+        case CsvKind::Typed: {
+            char text[TEXT_FORMAT_MAX];
+            int  length = TextFormat::formatColumn(results, column, csv.text, timeZone, text, memo);
+            return length < 0 ? writer.putNull() : writer.putValue(text, length, csv.numeric);
+        }
+
+        case CsvKind::Text: {
+            int         length = 0;
+            const char* value = results->getString(column, &length);
+            return value ? writer.putValue(value, length, csv.numeric) : writer.putNull();
+        }
+
+        case CsvKind::Binary: {
+            Bytes bytes = results->getBytes(column);
+            if (results->wasNull()) {
+                return writer.putNull();
+            }
+            return writer.putHex(bytes.data, bytes.data ? bytes.length : 0);
+        }
+
+        case CsvKind::Blob:
+        case CsvKind::Clob: {
+            Blob* blob = csv.kind == CsvKind::Blob ? results->getBlob(column) : nullptr;
+            Clob* clob = csv.kind == CsvKind::Clob ? results->getClob(column) : nullptr;
+            if (!blob && !clob) {
+                return writer.putNull();
+            }
+
+            int length = blob ? blob->length() : clob->length();
+            scratch.resize(std::max(length, 0));
+            if (length > 0 && blob) {
+                blob->getBytes(0, length, (unsigned char*)&scratch[0]);
+            } else if (length > 0) {
+                clob->getChars(0, length, &scratch[0]);
+            }
+            if (blob) {
+                blob->release();
+            } else {
+                clob->release();
+            }
+
+            return blob ? writer.putHex((const uint8_t*)scratch.data(), scratch.size())
+                        : writer.putValue(scratch.data(), scratch.size(), false);
+        }
+    }
+
+    return true;
+}
+
+// Just enough of a FlatBuffers writer for the Arrow IPC messages.  Objects
+// are written front to back, the vtable of each table just before it;
+// since FlatBuffers offsets only point forward, the strings, vectors and
+// tables a table refers to are written after it, and the offsets to them
+// patched in then.  Numbers are stored little-endian, as on the hosts the
+// driver is built for.
+class FlatBuilder final
+{
+public:
+    // A field of a table: its id in the schema, and either a scalar of size
+    // bytes, or, if slot isn't null, an offset to an object to be written
+    // later, whose place is stored in *slot for patch().
+    struct Field
+    {
+        int      id;
+        int      size;
+        uint64_t value;
+        size_t*  slot;
+    };
+
+    // The root offset goes first.
+    FlatBuilder() : bytes(4, 0) {}
+
+    size_t table(std::initializer_list<Field> fields)
+    {
+        // lay the fields out after the vtable offset, largest first, each
+        // aligned to its size
+        std::vector<Field> order(fields);
+        std::stable_sort(order.begin(), order.end(), [](const Field& a, const Field& b) { return a.size > b.size; });
+
+        int count = 0;
+        for (const Field& field : order) {
+            count = std::max(count, field.id + 1);
+        }
+
+        std::vector<uint16_t> offsets(count, 0);
+        size_t                size = 4;
+        for (const Field& field : order) {
+            size = (size + field.size - 1) / field.size * field.size;
+            offsets[field.id] = (uint16_t)size;
+            size += field.size;
+        }
+
+        pad(2);
+        size_t vtable = bytes.size();
+        put(4 + 2 * count, 2);
+        put(size, 2);
+        for (uint16_t offset : offsets) {
+            put(offset, 2);
+        }
+
+        pad(8);
+        size_t start = bytes.size();
+        bytes.resize(start + size, 0);
+        store(start, start - vtable, 4);
+        for (const Field& field : order) {
+            if (field.slot) {
+                *field.slot = start + offsets[field.id];
+            } else {
+                store(start + offsets[field.id], field.value, field.size);
+            }
+        }
+
+        return start;
+    }
+
+    size_t string(const std::string& value)
+    {
+        pad(4);
+        size_t start = bytes.size();
+        put(value.size(), 4);
+        bytes.insert(bytes.end(), value.begin(), value.end());
+        bytes.push_back(0);
+        return start;
+    }
+
+    // A vector of count offsets, the place of each in slots.
+    size_t offsets(size_t count, std::vector<size_t>& slots)
+    {
+        pad(4);
+        size_t start = bytes.size();
+        put(count, 4);
+        slots.resize(count);
+        for (size_t n = 0; n < count; ++n) {
+            slots[n] = bytes.size();
+            put(0, 4);
+        }
+        return start;
+    }
+
+    // A vector of structs of 64 bit numbers.
+    size_t structs(const std::vector<int64_t>& values, size_t fieldsPerStruct)
+    {
+        while ((bytes.size() + 4) % 8 != 0) {
+            bytes.push_back(0);
+        }
+        size_t start = bytes.size();
+        put(values.size() / fieldsPerStruct, 4);
+        for (int64_t value : values) {
+            put((uint64_t)value, 8);
+        }
+        return start;
+    }
+
+    void patch(size_t slot, size_t target) { store(slot, target - slot, 4); }
+    void setRoot(size_t table) { store(0, table, 4); }
+
+    // The message, padded to a multiple of 8 bytes.
+    const std::vector<uint8_t>& finish()
+    {
+        pad(8);
+        return bytes;
+    }
+
+private:
+    void pad(size_t alignment)
+    {
+        while (bytes.size() % alignment != 0) {
+            bytes.push_back(0);
+        }
+    }
+
+    void put(uint64_t value, int size)
+    {
+        size_t at = bytes.size();
+        bytes.resize(at + size);
+        store(at, value, size);
+    }
+
+    void store(size_t at, uint64_t value, int size)
+    {
+        for (int n = 0; n < size; ++n) {
+            bytes[at + n] = (uint8_t)(value >> (8 * n));
+        }
+    }
+
+    std::vector<uint8_t> bytes;
+};
+
+// The Type union of Schema.fbs.
+enum IpcType : uint8_t
+{
+    IPC_INT = 2,
+    IPC_FLOATING_POINT = 3,
+    IPC_BOOL = 6,
+    IPC_DECIMAL = 7,
+    IPC_DATE = 8,
+    IPC_TIME = 9,
+    IPC_TIMESTAMP = 10,
+    IPC_LARGE_BINARY = 19,
+    IPC_LARGE_UTF8 = 20,
+};
+
+static IpcType getIpcType(ArrowExport::ArrowKind kind)
+{
+    using ArrowExport::ArrowKind;
+
+    switch (kind) {
+        case ArrowKind::Boolean:
+            return IPC_BOOL;
+        case ArrowKind::Int8:
+        case ArrowKind::Int16:
+        case ArrowKind::Int32:
+        case ArrowKind::Int64:
+            return IPC_INT;
+        case ArrowKind::Float:
+        case ArrowKind::Double:
+            return IPC_FLOATING_POINT;
+        case ArrowKind::Decimal:
+            return IPC_DECIMAL;
+        case ArrowKind::Date:
+            return IPC_DATE;
+        case ArrowKind::Time:
+            return IPC_TIME;
+        case ArrowKind::Timestamp:
+        case ArrowKind::TimestampNoTZ:
+            return IPC_TIMESTAMP;
+        case ArrowKind::Binary:
+        case ArrowKind::Blob:
+            return IPC_LARGE_BINARY;
+        default:
+            return IPC_LARGE_UTF8;
+    }
+}
+
+// The type table of a field of column.
+static size_t writeIpcType(FlatBuilder& builder, const ArrowExport::ArrowColumn& column)
+{
+    using ArrowExport::ArrowKind;
+
+    const int MICROSECOND = 2;
+    size_t    slot = 0;
+
+    switch (column.kind) {
+        case ArrowKind::Int8:
+        case ArrowKind::Int16:
+        case ArrowKind::Int32:
+        case ArrowKind::Int64:
+            // bitWidth, is_signed
+            return builder.table({ { 0, 4, ArrowExport::getWidth(column.kind) * 8, nullptr }, { 1, 1, 1, nullptr } });
+
+        case ArrowKind::Float:
+        case ArrowKind::Double:
+            // precision: SINGLE or DOUBLE
+            return builder.table({ { 0, 2, column.kind == ArrowKind::Float ? 1u : 2u, nullptr } });
+
+        case ArrowKind::Decimal:
+            // precision, scale, bitWidth
+            return builder.table({ { 0, 4, (uint64_t)column.precision, nullptr }, { 1, 4, (uint64_t)column.scale, nullptr },
+                                   { 2, 4, 128, nullptr } });
+
+        case ArrowKind::Date:
+            // unit: DAY
+            return builder.table({ { 0, 2, 0, nullptr } });
+
+        case ArrowKind::Time:
+            // unit, bitWidth
+            return builder.table({ { 0, 2, MICROSECOND, nullptr }, { 1, 4, 64, nullptr } });
+
+        case ArrowKind::Timestamp: {
+            // unit, timezone
+            size_t table = builder.table({ { 0, 2, MICROSECOND, nullptr }, { 1, 4, 0, &slot } });
+            builder.patch(slot, builder.string("UTC"));
+            return table;
+        }
+
+        case ArrowKind::TimestampNoTZ:
+            return builder.table({ { 0, 2, MICROSECOND, nullptr } });
+
+        default:
+            // Bool, LargeUtf8 and LargeBinary have no fields
+            return builder.table({});
+    }
+}
+
+static std::vector<uint8_t> getSchemaMessage(const std::vector<ArrowExport::ArrowColumn>& columns)
+{
+    FlatBuilder builder;
+    size_t      header = 0;
+    size_t      fields = 0;
+
+    // Message: version, header_type, header, bodyLength
+    builder.setRoot(builder.table({ { 0, 2, ARROW_IPC_VERSION, nullptr }, { 1, 1, ARROW_IPC_SCHEMA, nullptr },
+                                    { 2, 4, 0, &header }, { 3, 8, 0, nullptr } }));
+
+    // Schema: endianness (little), fields
+    builder.patch(header, builder.table({ { 0, 2, 0, nullptr }, { 1, 4, 0, &fields } }));
+
+    std::vector<size_t> slots;
+    builder.patch(fields, builder.offsets(columns.size(), slots));
+
+    for (size_t n = 0; n < columns.size(); ++n) {
+        size_t name = 0;
+        size_t type = 0;
+        size_t children = 0;
+
+        // Field: name, nullable, type_type, type, children
+        builder.patch(slots[n], builder.table({ { 0, 4, 0, &name }, { 1, 1, columns[n].nullable, nullptr },
+                                                { 2, 1, getIpcType(columns[n].kind), nullptr }, { 3, 4, 0, &type },
+                                                { 5, 4, 0, &children } }));
+        builder.patch(name, builder.string(columns[n].name));
+        builder.patch(type, writeIpcType(builder, columns[n]));
+
+        std::vector<size_t> none;
+        builder.patch(children, builder.offsets(0, none));
+    }
+
+    return builder.finish();
+}
+
+// A record batch message, and the pieces of its body: the buffers of the
+// batch, each padded to a multiple of 8 bytes.
+struct IpcBatch
+{
+    uint32_t                prefix[2];
+    std::vector<uint8_t>    metadata;
+    std::vector<const void*> data;
+    std::vector<size_t>     lengths;
+};
+
+static void getBatchMessage(const std::vector<ArrowExport::ArrowColumn>& columns, const ArrowArray& batch, IpcBatch& message)
+{
+    std::vector<int64_t> nodes;      // length, null_count
+    std::vector<int64_t> buffers;    // offset, length
+    int64_t              bodyLength = 0;
+    int64_t              rows = batch.length;
+
+    auto addBuffer = [&](const void* data, int64_t length) {
+        buffers.push_back(bodyLength);
+        buffers.push_back(length);
+        message.data.push_back(data);
+        message.lengths.push_back((size_t)length);
+        bodyLength += (length + 7) / 8 * 8;
+    };
+
+    for (size_t n = 0; n < columns.size(); ++n) {
+        const ArrowArray* array = batch.children[n];
+        ArrowExport::ArrowKind kind = columns[n].kind;
+
+        nodes.push_back(rows);
+        nodes.push_back(array->null_count);
+
+        addBuffer(array->buffers[0], array->null_count > 0 ? (rows + 7) / 8 : 0);
+        if (ArrowExport::isVariable(kind)) {
+            const int64_t* offsets = (const int64_t*)array->buffers[1];
+            addBuffer(offsets, (rows + 1) * (int64_t)sizeof(int64_t));
+            addBuffer(array->buffers[2], offsets[rows]);
+        } else if (kind == ArrowExport::ArrowKind::Boolean) {
+            addBuffer(array->buffers[1], (rows + 7) / 8);
+        } else {
+            addBuffer(array->buffers[1], rows * (int64_t)ArrowExport::getWidth(kind));
+        }
+    }
+
+    FlatBuilder builder;
+    size_t      header = 0;
+    size_t      nodesSlot = 0;
+    size_t      buffersSlot = 0;
+
+    // Message: version, header_type, header, bodyLength
+    builder.setRoot(builder.table({ { 0, 2, ARROW_IPC_VERSION, nullptr }, { 1, 1, ARROW_IPC_RECORD_BATCH, nullptr },
+                                    { 2, 4, 0, &header }, { 3, 8, (uint64_t)bodyLength, nullptr } }));
+
+    // RecordBatch: length, nodes, buffers
+    builder.patch(header, builder.table({ { 0, 8, (uint64_t)rows, nullptr }, { 1, 4, 0, &nodesSlot }, { 2, 4, 0, &buffersSlot } }));
+    builder.patch(nodesSlot, builder.structs(nodes, 2));
+    builder.patch(buffersSlot, builder.structs(buffers, 2));
+
+    message.metadata = builder.finish();
+    message.prefix[0] = ARROW_IPC_CONTINUATION;
+    message.prefix[1] = (uint32_t)message.metadata.size();
+}
+
+// Queue a message, its metadata and then its body.
+static void queueMessage(OutputFile& output, const uint32_t* prefix, const std::vector<uint8_t>& metadata,
+                         const std::vector<const void*>& data, const std::vector<size_t>& lengths)
+{
+    static const uint8_t zeros[8] = { 0 };
+
+    output.queue(prefix, 2 * sizeof(uint32_t));
+    output.queue(metadata.data(), metadata.size());
+    for (size_t n = 0; n < data.size(); ++n) {
+        output.queue(data[n], lengths[n]);
+        output.queue(zeros, (8 - lengths[n] % 8) % 8);
+    }
+}
+
+} // namespace RESULT_EXPORT
+
+namespace ResultExport {
+
+std::vector<CsvColumn> describeCsv(ResultSetMetaData* metaData)
+{
+    int                    count = metaData->getColumnCount();
+    std::vector<CsvColumn> columns(count);
+
+    for (int n = 1; n <= count; ++n) {
+        CsvColumn& column = columns[n - 1];
+        int        type = metaData->getColumnType(n);
+
+        const char* name = metaData->getColumnLabel(n);
+        if (name == nullptr || *name == 0) {
+            name = metaData->getColumnName(n);
+        }
+        column.name = name ? name : "";
+        column.text = TextFormat::getTextKind(metaData, n);
+        if (type == (int)NUOSQL_BLOB) {
+            column.kind = CsvKind::Blob;
+        } else if (type == (int)NUOSQL_CLOB) {
+            column.kind = CsvKind::Clob;
+        } else if (OdbcTypeMapper::isInlineBinary(type)) {
+            column.kind = CsvKind::Binary;
+        } else if (column.text != TextFormat::TextKind::None) {
+            column.kind = CsvKind::Typed;
+        }
+
+        column.numeric = type == (int)NUOSQL_DECIMAL || type == (int)NUOSQL_NUMERIC || column.text == TextFormat::TextKind::Integer
+                         || column.text == TextFormat::TextKind::Float || column.text == TextFormat::TextKind::Double;
+    }
+
+    return columns;
+}
+
+bool writeCsv(ResultSet* results, const std::vector<CsvColumn>& columns, TimeZoneCache* timeZone,
+              const NuoODBCExportOptions& options, size_t maxRows, OutputFile& output, size_t* rows)
+{
+    RESULT_EXPORT::CsvWriter writer(options, output);
+    std::string              scratch;
+    DateTime::DayMemo        memo;
+
+    *rows = 0;
+    if (options.header) {
+        for (size_t n = 0; n < columns.size(); ++n) {
+            if ((n > 0 && !writer.putDelimiter()) || !writer.putValue(columns[n].name.data(), columns[n].name.size(), false)) {
+                return false;
+            }
+        }
+        if (!writer.putLineEnd()) {
+            return false;
+        }
+    }
+
+    while (*rows < maxRows && results->next()) {
+        for (size_t n = 0; n < columns.size(); ++n) {
+            if ((n > 0 && !writer.putDelimiter())
+                || !RESULT_EXPORT::writeCsvValue(writer, results, (int)n + 1, columns[n], timeZone, &memo, scratch)) {
+                return false;
+            }
+        }
+        if (!writer.putLineEnd()) {
+            return false;
+        }
+        ++*rows;
+    }
+
+    return writer.flush();
+}
+
+bool writeArrowIpc(ResultSet* results, const std::vector<ArrowExport::ArrowColumn>& columns, TimeZoneCache* timeZone,
+                   const NuoODBCExportOptions& options, size_t maxRows, OutputFile& output, size_t* rows)
+{
+    static const uint32_t end[2] = { ARROW_IPC_CONTINUATION, 0 };
+
+    size_t batchRows = options.batchRows > 0 ? (size_t)options.batchRows : RESULT_EXPORT_BATCH_ROWS;
+
+    std::vector<uint8_t> schema = RESULT_EXPORT::getSchemaMessage(columns);
+    uint32_t             prefix[2] = { ARROW_IPC_CONTINUATION, (uint32_t)schema.size() };
+    RESULT_EXPORT::queueMessage(output, prefix, schema, {}, {});
+    if (!output.flush()) {
+        return false;
+    }
+
+    *rows = 0;
+    while (*rows < maxRows) {
+        ArrowArray batch;
+        if (ArrowExport::exportBatch(results, columns, timeZone, std::min(batchRows, maxRows - *rows), &batch) == 0) {
+            break;
+        }
+
+        RESULT_EXPORT::IpcBatch message;
+        RESULT_EXPORT::getBatchMessage(columns, batch, message);
+        RESULT_EXPORT::queueMessage(output, message.prefix, message.metadata, message.data, message.lengths);
+        bool written = output.flush();
+        *rows += (size_t)batch.length;
+        batch.release(&batch);
+        if (!written) {
+            return false;
+        }
+    }
+
+    output.queue(end, sizeof(end));
+    return output.flush();
+}
+
+}
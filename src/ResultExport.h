@@ -0,0 +1,86 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "ArrowExport.h"
+#include "NuoODBCExport.h"
+#include "TextFormat.h"
+
+// Buffered writes to a file descriptor.  Pieces of memory are queued, and
+// written with as few system calls as they can be (writev where there is
+// one); a piece has to stay put until the flush that writes it.
+class OutputFile final
+{
+public:
+    explicit OutputFile(int fd) : fd(fd) {}
+
+    void queue(const void* data, size_t length);
+
+    // Write out everything queued: false, with the errno kept, if that fails.
+    bool flush();
+
+    size_t getQueued() const { return queued; }
+    int    getError() const { return error; }
+
+private:
+    struct Piece
+    {
+        const void* data;
+        size_t      length;
+    };
+
+    int                fd;
+    int                error = 0;
+    size_t             queued = 0;
+    std::vector<Piece> pieces;
+};
+
+// The rows of a result set written to an OutputFile: see NuoODBCExport.h.
+// Each writer reads rows until maxRows have been written or there are no
+// more, counting them in *rows; it returns false if the output can't be
+// written, and throws SQLException if results do.
+namespace ResultExport {
+
+// The buffer CSV rows are formatted into, written out whenever it fills.
+#define RESULT_EXPORT_BUFFER (1024 * 1024)
+
+// Record batch rows when the options don't say.
+#define RESULT_EXPORT_BATCH_ROWS 65536
+
+// How the values of a column are read for CSV.
+enum class CsvKind : char
+{
+    Text,       // getString
+    Typed,      // formatted by the driver: see TextFormat
+    Binary,     // hex digits
+    Blob,
+    Clob,
+};
+
+struct CsvColumn
+{
+    CsvKind              kind = CsvKind::Text;
+    TextFormat::TextKind text = TextFormat::TextKind::None;
+    std::string          name;
+    bool                 numeric = false;   // not quoted by NUOODBC_QUOTE_NONNUMERIC
+};
+
+std::vector<CsvColumn> describeCsv(NuoDB::ResultSetMetaData* metaData);
+
+bool writeCsv(NuoDB::ResultSet* results, const std::vector<CsvColumn>& columns, TimeZoneCache* timeZone,
+              const NuoODBCExportOptions& options, size_t maxRows, OutputFile& output, size_t* rows);
+
+// The columns are those of ArrowExport::describe.
+bool writeArrowIpc(NuoDB::ResultSet* results, const std::vector<ArrowExport::ArrowColumn>& columns, TimeZoneCache* timeZone,
+                   const NuoODBCExportOptions& options, size_t maxRows, OutputFile& output, size_t* rows);
+
+}
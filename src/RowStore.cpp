@@ -0,0 +1,408 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+#include "RowStore.h"
+
+#include "OdbcBase.h"
+
+#if defined(_WIN32)
+# include <io.h>
+#else
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/Clob.h"
+#include "NuoRemote/DateClass.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/TimeClass.h"
+#include "NuoRemote/Timestamp.h"
+
+using namespace NuoDB;
+
+namespace ROW_STORE {
+
+// A temporary file that segments are mapped from, deleted when it's
+// closed.  Each map() adds a region to the end of the file.
+class SpillFile
+{
+public:
+    SpillFile()
+        : file(tmpfile())
+    {
+    }
+
+    ~SpillFile()
+    {
+        if (file) {
+            fclose(file);
+        }
+    }
+
+    // Return nullptr if the file can't grow or be mapped.
+    char* map(size_t size)
+    {
+        if (!file) {
+            return nullptr;
+        }
+
+#if defined(_WIN32)
+        HANDLE         handle = (HANDLE)_get_osfhandle(_fileno(file));
+        ULARGE_INTEGER end;
+        end.QuadPart = length + size;
+
+        // mapping beyond the end of the file extends it
+        HANDLE mapping = CreateFileMapping(handle, NULL, PAGE_READWRITE, end.HighPart, end.LowPart, NULL);
+        if (!mapping) {
+            return nullptr;
+        }
+
+        ULARGE_INTEGER offset;
+        offset.QuadPart = length;
+        void* data = MapViewOfFile(mapping, FILE_MAP_WRITE, offset.HighPart, offset.LowPart, size);
+        CloseHandle(mapping);
+        if (!data) {
+            return nullptr;
+        }
+#else
+        if (ftruncate(fileno(file), (off_t)(length + size)) != 0) {
+            return nullptr;
+        }
+
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(file), (off_t)length);
+        if (data == MAP_FAILED) {
+            return nullptr;
+        }
+#endif
+
+        length += size;
+        return (char*)data;
+    }
+
+    static void unmap(char* data, size_t size)
+    {
+#if defined(_WIN32)
+        (void)size;
+        UnmapViewOfFile(data);
+#else
+        munmap(data, size);
+#endif
+    }
+
+private:
+    FILE*    file;
+    uint64_t length = 0;
+};
+
+static void putVarint(std::vector<char>& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back((char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+static uint64_t getVarint(const char*& in)
+{
+    uint64_t value = 0;
+    int      shift = 0;
+    for (;;) {
+        unsigned char byte = (unsigned char)*in++;
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+        shift += 7;
+    }
+}
+
+// Small negative numbers stay small.
+static uint64_t zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static void putBytes(std::vector<char>& out, const char* data, size_t length)
+{
+    putVarint(out, length);
+    out.insert(out.end(), data, data + length);
+}
+
+static void releaseHandle(void* object, StagedKind kind)
+{
+    if (kind == StagedKind::Blob) {
+        ((Blob*)object)->release();
+    } else {
+        ((Clob*)object)->release();
+    }
+}
+
+// Keep the seconds, and the nanoseconds of values that have them, of a
+// date/time value, and let the client's object go.
+template <bool nanos, class Value>
+static bool putDateTime(std::vector<char>& out, ResultSet* base, Value* value)
+{
+    if (!value) {
+        return false;
+    }
+    if (base->wasNull()) {
+        value->release();
+        return false;
+    }
+
+    putVarint(out, zigzag(value->getSeconds()));
+    if constexpr (nanos) {
+        putVarint(out, (uint32_t)value->getNanos());
+    }
+    value->release();
+    return true;
+}
+
+} // namespace ROW_STORE
+
+RowStore::RowStore(const std::vector<StagedKind>& columnKinds, size_t budget, const std::vector<int>* only,
+                   MemoryAccount* account)
+    : kinds(columnKinds),
+      nullBytes((columnKinds.size() + 7) / 8),
+      memoryBudget(budget),
+      memoryCharge(account, MemoryUse::Cursors)
+{
+    for (size_t n = 0; n < kinds.size(); ++n) {
+        columns.push_back(only ? (*only)[n] : (int)n + 1);
+    }
+}
+
+RowStore::~RowStore()
+{
+    for (auto& handle : handles) {
+        ROW_STORE::releaseHandle(handle.first, handle.second);
+    }
+
+    for (Segment& segment : segments) {
+        if (segment.mapped) {
+            ROW_STORE::SpillFile::unmap(segment.data, segment.size);
+        } else {
+            free(segment.data);
+        }
+    }
+}
+
+void RowStore::append(ResultSet* base)
+{
+    encode(base);
+
+    Location location;
+    char*    data = allocate(record.size(), &location);
+    memcpy(data, record.data(), record.size());
+    rows.push_back(location);
+}
+
+// The LOB is charged at its length, as much as the client can hold for it.
+void RowStore::addHandle(void* object, StagedKind kind)
+{
+    int length = kind == StagedKind::Blob ? ((Blob*)object)->length() : ((Clob*)object)->length();
+
+    ROW_STORE::putVarint(record, handles.size());
+    handles.emplace_back(object, kind);
+    handleBytes += sizeof(handles[0]) + (length > 0 ? (size_t)length : 0);
+    memoryCharge.force(getMemoryUsed());
+}
+
+// Encode the current row of base into record.  An exception thrown by the
+// base leaves the handles of the columns read so far to the destructor.
+void RowStore::encode(ResultSet* base)
+{
+    record.assign(nullBytes, 0);
+
+    for (size_t n = 0; n < kinds.size(); ++n) {
+        int  column = columns[n];
+        bool null = false;
+
+        switch (kinds[n]) {
+            case StagedKind::Integer: {
+                int64_t value = base->getLong(column);
+                if (!(null = base->wasNull())) {
+                    ROW_STORE::putVarint(record, ROW_STORE::zigzag(value));
+                }
+                break;
+            }
+
+            case StagedKind::Real: {
+                double value = base->getDouble(column);
+                if (!(null = base->wasNull())) {
+                    const char* bytes = (const char*)&value;
+                    record.insert(record.end(), bytes, bytes + sizeof(value));
+                }
+                break;
+            }
+
+            case StagedKind::String: {
+                int         length = 0;
+                const char* string = base->getString(column, &length);
+                if (!(null = !string || base->wasNull())) {
+                    ROW_STORE::putBytes(record, string, length);
+                }
+                break;
+            }
+
+            case StagedKind::Bytes: {
+                Bytes bytes = base->getBytes(column);
+                if (!(null = base->wasNull())) {
+                    ROW_STORE::putBytes(record, (const char*)bytes.data, bytes.data ? bytes.length : 0);
+                }
+                break;
+            }
+
+            case StagedKind::Date:
+                null = !ROW_STORE::putDateTime<false>(record, base, base->getDate(column));
+                break;
+
+            case StagedKind::Time:
+                null = !ROW_STORE::putDateTime<true>(record, base, base->getTime(column));
+                break;
+
+            case StagedKind::Timestamp:
+                null = !ROW_STORE::putDateTime<true>(record, base, base->getTimestamp(column));
+                break;
+
+            case StagedKind::TimestampNoTZ:
+                null = !ROW_STORE::putDateTime<true>(record, base, base->getTimestampNoTZ(column));
+                break;
+
+            default: {
+                void* object = nullptr;
+                if (kinds[n] == StagedKind::Blob) {
+                    object = base->getBlob(column);
+                } else {
+                    object = base->getClob(column);
+                }
+                if (object && base->wasNull()) {
+                    ROW_STORE::releaseHandle(object, kinds[n]);
+                    object = nullptr;
+                }
+                if (!(null = !object)) {
+                    addHandle(object, kinds[n]);
+                }
+                break;
+            }
+        }
+
+        if (null) {
+            record[n / 8] |= (char)(1 << (n % 8));
+        }
+    }
+}
+
+// Find room for a record of bytes at the end of the last segment, or in a
+// new one: in memory while the budget and the account allow, mapped from
+// the spill file after that.
+char* RowStore::allocate(size_t bytes, Location* location)
+{
+    if (segments.empty() || segments.back().size - segments.back().used < bytes) {
+        size_t size = ROW_STORE_SEGMENT;
+        if (bytes > size) {
+            size = (bytes + ROW_STORE_GRANULARITY - 1) / ROW_STORE_GRANULARITY * ROW_STORE_GRANULARITY;
+        }
+
+        Segment segment = { nullptr, size, 0, false };
+        if (getMemoryUsed() + size > memoryBudget || !memoryCharge.set(getMemoryUsed() + size)) {
+            if (!spill) {
+                spill.reset(new ROW_STORE::SpillFile());
+            }
+            segment.data = spill->map(size);
+            segment.mapped = segment.data != nullptr;
+        }
+        if (!segment.mapped) {
+            memoryCharge.force(getMemoryUsed() + size);
+            segment.data = (char*)malloc(size);
+            if (!segment.data) {
+                memoryCharge.force(getMemoryUsed());
+                throw std::bad_alloc();
+            }
+        }
+
+        if (segment.mapped) {
+            spilledBytes += size;
+        } else {
+            memoryUsed += size;
+        }
+        segments.push_back(segment);
+    }
+
+    Segment& segment = segments.back();
+    location->segment = (uint32_t)(segments.size() - 1);
+    location->offset = (uint32_t)segment.used;
+    segment.used += bytes;
+
+    return segment.data + location->offset;
+}
+
+void RowStore::read(size_t row, StagedRow& values) const
+{
+    const Location& location = rows[row];
+    const char*     nulls = segments[location.segment].data + location.offset;
+    const char*     in = nulls + nullBytes;
+
+    values.resize(kinds.size());
+
+    for (size_t n = 0; n < kinds.size(); ++n) {
+        StagedValue& value = values[n];
+        value.formatted = false;
+        value.object = nullptr;
+        if ((value.null = (nulls[n / 8] >> (n % 8)) & 1)) {
+            continue;
+        }
+
+        switch (kinds[n]) {
+            case StagedKind::Integer:
+                value.integer = ROW_STORE::unzigzag(ROW_STORE::getVarint(in));
+                break;
+
+            case StagedKind::Real:
+                memcpy(&value.real, in, sizeof(value.real));
+                in += sizeof(value.real);
+                break;
+
+            case StagedKind::String:
+            case StagedKind::Bytes: {
+                size_t length = (size_t)ROW_STORE::getVarint(in);
+                value.string.assign(in, length);
+                in += length;
+                break;
+            }
+
+            case StagedKind::Date:
+                value.integer = ROW_STORE::unzigzag(ROW_STORE::getVarint(in));
+                value.nanos = 0;
+                break;
+
+            case StagedKind::Time:
+            case StagedKind::Timestamp:
+            case StagedKind::TimestampNoTZ:
+                value.integer = ROW_STORE::unzigzag(ROW_STORE::getVarint(in));
+                value.nanos = (int32_t)ROW_STORE::getVarint(in);
+                break;
+
+            default:
+                value.object = handles[(size_t)ROW_STORE::getVarint(in)].first;
+                break;
+        }
+    }
+}
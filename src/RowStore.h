@@ -0,0 +1,105 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "MemoryAccount.h"
+#include "StagedResultSet.h"
+
+namespace NuoDB {
+class ResultSet;
+}
+
+namespace ROW_STORE {
+class SpillFile;
+}
+
+// Rows are packed into segments of this size, or of a multiple of
+// ROW_STORE_GRANULARITY for a row that doesn't fit in one.  Both are
+// multiples of the granularity a file can be mapped at on every platform.
+#define ROW_STORE_SEGMENT       (1024 * 1024)
+#define ROW_STORE_GRANULARITY   (64 * 1024)
+
+/**
+ * Rows copied out of a result set in a compact binary form: a bitmap of
+ * the NULL columns, then the value of each of the others by the kind of
+ * its column.  Integers are zigzag varints, reals their 8 bytes, strings
+ * and binary values a varint length and their bytes.  Date/time values
+ * are their seconds, as an integer, and but for dates their nanoseconds
+ * as a varint; they're read back as the driver's own objects.  LOB values
+ * keep the client object (and a reference on it), as there's no way to
+ * make one of those from anything else; the row holds its index.
+ *
+ * Segments are allocated in memory until they, and the LOBs kept, reach
+ * memoryBudget or the limit of the account they're charged to; the
+ * segments past that are mapped from a temporary file, so that the pages
+ * of rows that aren't being read can be written out and dropped.  Should
+ * the file not be available the segments go in memory regardless.  A LOB
+ * can't be spilled, so it's charged at its length whatever the limit.
+ */
+class RowStore final
+{
+public:
+    // The store's columns are the first of the result sets it's given, or
+    // those listed (1 based), in that order.  Its memory is charged to
+    // account, if there is one.
+    RowStore(const std::vector<StagedKind>& kinds, size_t memoryBudget, const std::vector<int>* columns = nullptr,
+             MemoryAccount* account = nullptr);
+    ~RowStore();
+
+    RowStore(const RowStore&) = delete;
+    RowStore& operator=(const RowStore&) = delete;
+
+    // Add the current row of base.
+    void   append(NuoDB::ResultSet* base);
+
+    // Read row (0 based) back into values.  LOB values are the store's
+    // objects: no reference is added for values.
+    void   read(size_t row, StagedRow& values) const;
+
+    size_t getRowCount() const    { return rows.size(); }
+    size_t getMemoryUsed() const  { return memoryUsed + handleBytes; }
+    size_t getSpilledBytes() const { return spilledBytes; }
+
+private:
+    struct Segment
+    {
+        char*  data;
+        size_t size;
+        size_t used;
+        bool   mapped;
+    };
+
+    struct Location
+    {
+        uint32_t segment;
+        uint32_t offset;
+    };
+
+    void   encode(NuoDB::ResultSet* base);
+    char*  allocate(size_t bytes, Location* location);
+    void   addHandle(void* object, StagedKind kind);
+
+    std::vector<StagedKind>               kinds;
+    std::vector<int>                      columns;
+    std::vector<Segment>                  segments;
+    std::vector<Location>                 rows;
+    std::vector<std::pair<void*, StagedKind>> handles;
+    std::vector<char>                     record;   // the row being appended
+    std::unique_ptr<ROW_STORE::SpillFile> spill;
+    size_t                                nullBytes;
+    size_t                                memoryBudget;
+    size_t                                memoryUsed = 0;   // by the segments in memory
+    size_t                                handleBytes = 0;  // charged for the LOBs kept
+    MemoryCharge                          memoryCharge;
+    size_t                                spilledBytes = 0;
+};
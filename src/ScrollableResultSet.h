@@ -0,0 +1,64 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "StagedResultSet.h"
+
+/**
+ * The result set behind a scrollable cursor, over rows staged from the
+ * statement's own result set.
+ *
+ * Rows are numbered from 1: position 0 is before the first row, and one
+ * past the last is after it.  Rows are found as the cursor first reaches
+ * them, so getRowsRead() is a lower bound on getRowCount() until the end
+ * has been reached.
+ */
+class ScrollableResultSet : public StagedResultSet
+{
+public:
+    using StagedResultSet::StagedResultSet;
+
+    // Move to row; return whether there's a row there.
+    virtual bool   absolute(size_t row) = 0;
+
+    // Move to row without reading it, as the next() that follows will.
+    virtual void   seek(size_t row) { absolute(row); }
+
+    // The number of rows the next fetch is for.
+    virtual void   setRowsetSize(size_t rows) { (void)rows; }
+
+    // Whether row has gone from the database since the cursor was opened.
+    virtual bool   isDeleted(size_t row) { (void)row; return false; }
+
+    // The number of rows, once all of them have been read.
+    virtual size_t getRowCount() = 0;
+    virtual size_t getRowsRead() const = 0;
+
+    size_t         getPosition() const { return position; }
+
+    virtual void addRef() { ++useCount; }
+    virtual int  release()
+    {
+        if (--useCount == 0) {
+            delete this;
+
+            return 0;
+        }
+
+        return useCount;
+    }
+    virtual bool next() { return absolute(position + 1); }
+
+protected:
+    size_t position = 0;
+
+private:
+    int    useCount = 1;
+};
@@ -24,6 +24,10 @@
 #define SETUP_USER          "User"
 #define SETUP_PASSWORD      "Password"
 #define SETUP_SCHEMA        "Schema"
+#define SETUP_PREFETCH      "Prefetch"
+#define SETUP_PARALLEL_FETCH "ParallelFetch"
+#define SETUP_FETCH_SIZE    "FetchSize"
+#define SETUP_MEMORY_LIMIT  "MemoryLimit"
 
 #define INSTALL_DRIVER      "Driver"
 #define INSTALL_SETUP       "Setup"
@@ -0,0 +1,595 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+
+#include "StagedResultSet.h"
+
+#include "OdbcBase.h"
+#include "DateTime.h"
+#include "OdbcTypeMapper.h"
+#include "TextFormat.h"
+
+#include "NuoRemote/Blob.h"
+#include "NuoRemote/Clob.h"
+#include "NuoRemote/DateClass.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "NuoRemote/TimeClass.h"
+#include "NuoRemote/Timestamp.h"
+
+using namespace NuoDB;
+
+namespace STAGED_RESULT_SET {
+
+static void releaseObject(StagedValue& value, StagedKind kind)
+{
+    if (!value.object) {
+        return;
+    }
+
+    switch (kind) {
+        case StagedKind::Date:
+            ((Date*)value.object)->release();
+            break;
+
+        case StagedKind::Time:
+            ((Time*)value.object)->release();
+            break;
+
+        case StagedKind::Timestamp:
+            ((Timestamp*)value.object)->release();
+            break;
+
+        case StagedKind::TimestampNoTZ:
+            ((TimestampNoTZ*)value.object)->release();
+            break;
+
+        case StagedKind::Blob:
+            ((Blob*)value.object)->release();
+            break;
+
+        case StagedKind::Clob:
+            ((Clob*)value.object)->release();
+            break;
+
+        default:
+            break;
+    }
+    value.object = nullptr;
+}
+
+// A date/time value of the driver's own, made from the seconds and
+// nanoseconds staged for it; it's deleted on its last release().
+template <class Client>
+class DateTimeValue final : public Client
+{
+public:
+    DateTimeValue(int64_t valueSeconds, int32_t valueNanos)
+        : seconds(valueSeconds),
+          nanos(valueNanos)
+    {}
+
+    virtual int64_t getSeconds() { return seconds; }
+    virtual int32_t getNanos()   { return nanos; }
+    virtual void    addRef()     { ++references; }
+
+    virtual int release()
+    {
+        int left = --references;
+        if (!left) {
+            delete this;
+        }
+        return left;
+    }
+
+private:
+    int64_t          seconds;
+    int32_t          nanos;
+    std::atomic<int> references { 1 };
+};
+
+} // namespace STAGED_RESULT_SET
+
+StagedResultSet::StagedResultSet(ResultSetMetaData* data, TimeZoneCache* zone, bool handles)
+    : metaData(data),
+      timeZone(zone)
+{
+    int count = metaData->getColumnCount();
+    kinds.resize(count);
+    for (int n = 0; n < count; ++n) {
+        getKind(metaData, n + 1, &kinds[n], handles);
+    }
+}
+
+StagedResultSet::StagedResultSet(ResultSetMetaData* data, TimeZoneCache* zone, const std::vector<StagedKind>& columnKinds)
+    : metaData(data),
+      timeZone(zone),
+      kinds(columnKinds)
+{
+}
+
+// Return false for columns that can't be staged: LOBs and binary values are
+// read through handles or buffers that belong to the current row, and are
+// only staged with handles.
+bool StagedResultSet::getKind(ResultSetMetaData* metaData, int column, StagedKind* kind, bool handles)
+{
+    int type = metaData->getColumnType(column);
+    if (type == (int)NUOSQL_BLOB || type == (int)NUOSQL_CLOB) {
+        *kind = type == (int)NUOSQL_BLOB ? StagedKind::Blob : StagedKind::Clob;
+        return handles;
+    }
+
+    switch ((int)OdbcTypeMapper::mapType(type)) {
+        case SQL_BIT:
+        case SQL_TINYINT:
+        case SQL_SMALLINT:
+        case SQL_INTEGER:
+        case SQL_BIGINT:
+            *kind = StagedKind::Integer;
+            return true;
+
+        case SQL_REAL:
+        case SQL_FLOAT:
+        case SQL_DOUBLE:
+            *kind = StagedKind::Real;
+            return true;
+
+        case SQL_DATE:
+        case SQL_TYPE_DATE:
+            *kind = StagedKind::Date;
+            return true;
+
+        case SQL_TIME:
+        case SQL_TYPE_TIME:
+            *kind = StagedKind::Time;
+            return true;
+
+        case SQL_TIMESTAMP:
+        case SQL_TYPE_TIMESTAMP:
+            *kind = DateTime::isWithoutTimeZone(metaData->getColumnTypeName(column)) ? StagedKind::TimestampNoTZ : StagedKind::Timestamp;
+            return true;
+
+        case SQL_BINARY:
+        case SQL_VARBINARY:
+        case SQL_LONGVARBINARY:
+            *kind = StagedKind::Bytes;
+            return handles;
+
+        default:
+            *kind = StagedKind::String;
+            return true;
+    }
+}
+
+bool StagedResultSet::canStage(ResultSetMetaData* metaData)
+{
+    int        count = metaData->getColumnCount();
+    StagedKind kind;
+
+    for (int n = 1; n <= count; ++n) {
+        if (!getKind(metaData, n, &kind)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void StagedResultSet::stageRow(ResultSet* base, StagedRow& staged, const std::vector<int>* only) const
+{
+    staged.resize(kinds.size());
+
+    size_t count = only ? only->size() : kinds.size();
+    for (size_t n = 0; n < count; ++n) {
+        int          column = only ? (*only)[n] : (int)n + 1;
+        StagedValue& value = staged[column - 1];
+
+        switch (kinds[column - 1]) {
+            case StagedKind::Integer:
+                value.integer = base->getLong(column);
+                break;
+
+            case StagedKind::Real:
+                value.real = base->getDouble(column);
+                break;
+
+            case StagedKind::String: {
+                int         length = 0;
+                const char* string = base->getString(column, &length);
+                if (string) {
+                    value.string.assign(string, length);
+                }
+                break;
+            }
+
+            case StagedKind::Date:
+                value.object = base->getDate(column);
+                break;
+
+            case StagedKind::Time:
+                value.object = base->getTime(column);
+                break;
+
+            case StagedKind::Timestamp:
+                value.object = base->getTimestamp(column);
+                break;
+
+            case StagedKind::TimestampNoTZ:
+                value.object = base->getTimestampNoTZ(column);
+                break;
+
+            case StagedKind::Blob:
+                value.object = base->getBlob(column);
+                break;
+
+            case StagedKind::Clob:
+                value.object = base->getClob(column);
+                break;
+
+            case StagedKind::Bytes: {
+                Bytes bytes = base->getBytes(column);
+                value.string.assign((const char*)bytes.data, bytes.data ? bytes.length : 0);
+                break;
+            }
+        }
+
+        value.null = base->wasNull();
+        value.formatted = false;
+    }
+}
+
+void StagedResultSet::releaseRow(StagedRow& staged) const
+{
+    for (size_t n = 0; n < staged.size(); ++n) {
+        STAGED_RESULT_SET::releaseObject(staged[n], kinds[n]);
+    }
+}
+
+size_t StagedResultSet::getSize(const StagedRow& staged) const
+{
+    size_t size = staged.size() * sizeof(StagedValue);
+    for (size_t n = 0; n < staged.size(); ++n) {
+        if (kinds[n] == StagedKind::String || kinds[n] == StagedKind::Bytes) {
+            size += staged[n].string.size();
+        }
+    }
+
+    return size;
+}
+
+bool StagedResultSet::wasNull()
+{
+    return lastNull;
+}
+
+int StagedResultSet::findColumn(const char* columnName)
+{
+    for (int n = 1; n <= (int)kinds.size(); ++n) {
+        if (!strcasecmp(metaData->getColumnName(n), columnName)) {
+            return n;
+        }
+    }
+
+    return 0;
+}
+
+ResultSetMetaData* StagedResultSet::getMetaData()
+{
+    return metaData;
+}
+
+StagedValue& StagedResultSet::getValue(int column)
+{
+    static thread_local StagedValue missing;
+
+    if (column < 1 || column > (int)kinds.size() || !row) {
+        missing.null = true;
+        lastNull = true;
+        return missing;
+    }
+
+    StagedValue& value = (*row)[column - 1];
+    lastNull = value.null;
+    return value;
+}
+
+int64_t StagedResultSet::getInteger(int column)
+{
+    StagedValue& value = getValue(column);
+    if (value.null) {
+        return 0;
+    }
+
+    switch (kinds[column - 1]) {
+        case StagedKind::Integer:
+            return value.integer;
+
+        case StagedKind::Real:
+            return (int64_t)value.real;
+
+        case StagedKind::String:
+            return strtoll(value.string.c_str(), NULL, 10);
+
+        default:
+            return 0;
+    }
+}
+
+double StagedResultSet::getReal(int column)
+{
+    StagedValue& value = getValue(column);
+    if (value.null) {
+        return 0;
+    }
+
+    switch (kinds[column - 1]) {
+        case StagedKind::Integer:
+            return (double)value.integer;
+
+        case StagedKind::Real:
+            return value.real;
+
+        case StagedKind::String:
+            return strtod(value.string.c_str(), NULL);
+
+        default:
+            return 0;
+    }
+}
+
+// Produce the text of a non-string value, the first time it's asked for.
+void StagedResultSet::format(StagedValue& value, StagedKind kind)
+{
+    char buffer[TEXT_FORMAT_MAX];
+    int  length = 0;
+
+    switch (kind) {
+        case StagedKind::Integer:
+            length = TextFormat::formatInteger(value.integer, buffer);
+            break;
+
+        case StagedKind::Real:
+            length = TextFormat::formatDouble(value.real, buffer);
+            break;
+
+        case StagedKind::Date:
+        case StagedKind::Time:
+        case StagedKind::Timestamp:
+        case StagedKind::TimestampNoTZ: {
+            DateTime::Fields fields;
+            int64_t          seconds;
+            int32_t          nanos = 0;
+
+            if (!value.object) {
+                seconds = value.integer;
+                nanos = value.nanos;
+            } else if (kind == StagedKind::Date) {
+                seconds = ((Date*)value.object)->getSeconds();
+            } else if (kind == StagedKind::Time) {
+                seconds = ((Time*)value.object)->getSeconds();
+            } else if (kind == StagedKind::Timestamp) {
+                seconds = ((Timestamp*)value.object)->getSeconds();
+                nanos = ((Timestamp*)value.object)->getNanos();
+            } else {
+                seconds = ((TimestampNoTZ*)value.object)->getSeconds();
+                nanos = ((TimestampNoTZ*)value.object)->getNanos();
+            }
+
+            if (kind == StagedKind::TimestampNoTZ) {
+                DateTime::fromSeconds(seconds, &fields);
+            } else {
+                timeZone->toLocal(seconds, &fields, &memo);
+            }
+
+            if (kind == StagedKind::Date) {
+                length = TextFormat::formatDate(fields, buffer);
+            } else if (kind == StagedKind::Time) {
+                length = TextFormat::formatTime(fields, buffer);
+            } else {
+                length = TextFormat::formatTimestamp(fields, nanos, buffer);
+            }
+            break;
+        }
+
+        // the whole of a LOB, as the client's getString would return it
+        case StagedKind::Blob:
+        case StagedKind::Clob: {
+            int size = value.object ? (kind == StagedKind::Blob ? ((Blob*)value.object)->length() : ((Clob*)value.object)->length()) : 0;
+            value.string.resize(size);
+            if (size > 0 && kind == StagedKind::Blob) {
+                ((Blob*)value.object)->getBytes(0, size, (unsigned char*)&value.string[0]);
+            } else if (size > 0) {
+                ((Clob*)value.object)->getChars(0, size, &value.string[0]);
+            }
+            value.formatted = true;
+            return;
+        }
+
+        case StagedKind::String:
+        case StagedKind::Bytes:
+            return;
+    }
+
+    value.string.assign(buffer, length);
+    value.formatted = true;
+}
+
+const char* StagedResultSet::getString(int column, int* n_chars)
+{
+    StagedValue& value = getValue(column);
+    if (value.null) {
+        *n_chars = 0;
+        return NULL;
+    }
+
+    StagedKind kind = kinds[column - 1];
+    if (kind != StagedKind::String && kind != StagedKind::Bytes && !value.formatted) {
+        format(value, kind);
+    }
+
+    *n_chars = (int)value.string.size();
+    return value.string.c_str();
+}
+
+const char* StagedResultSet::getString(int column)
+{
+    int length;
+    return getString(column, &length);
+}
+
+const char* StagedResultSet::getString(const char* columnName)
+{
+    return getString(findColumn(columnName));
+}
+
+bool StagedResultSet::getBoolean(int column)
+{
+    StagedValue& value = getValue(column);
+    if (!value.null && kinds[column - 1] == StagedKind::String && !strcasecmp(value.string.c_str(), "true")) {
+        return true;
+    }
+    return getInteger(column) != 0;
+}
+
+#define GEN_INTEGER(NAME, TYPE)                                         \
+    TYPE StagedResultSet::get ## NAME(int column)                       \
+    {                                                                   \
+        return (TYPE)getInteger(column);                                \
+    }
+
+#define GEN_REAL(NAME, TYPE)                                            \
+    TYPE StagedResultSet::get ## NAME(int column)                       \
+    {                                                                   \
+        return (TYPE)getReal(column);                                   \
+    }
+
+#define GEN_OBJECT(NAME, TYPE, KIND)                                    \
+    TYPE StagedResultSet::get ## NAME(int column)                       \
+    {                                                                   \
+        StagedValue& value = getValue(column);                          \
+        if (!value.object || kinds[column - 1] != StagedKind::KIND) {   \
+            return nullptr;                                             \
+        }                                                               \
+        ((TYPE)value.object)->addRef();                                 \
+        return (TYPE)value.object;                                      \
+    }
+
+// Date/time values can only be read from columns of the same type.  One
+// staged without the client's object is made again as the driver's own.
+#define GEN_DATE_TIME(NAME, CLASS, KIND)                                \
+    NuoDB::CLASS* StagedResultSet::get ## NAME(int column)              \
+    {                                                                   \
+        StagedValue& value = getValue(column);                          \
+        if (value.null || kinds[column - 1] != StagedKind::KIND) {      \
+            return nullptr;                                             \
+        }                                                               \
+        if (!value.object) {                                            \
+            return new STAGED_RESULT_SET::DateTimeValue<NuoDB::CLASS>(value.integer, value.nanos); \
+        }                                                               \
+        ((NuoDB::CLASS*)value.object)->addRef();                        \
+        return (NuoDB::CLASS*)value.object;                             \
+    }
+
+#define GEN_BY_NAME(NAME, TYPE)                                         \
+    TYPE StagedResultSet::get ## NAME(const char* columnName)           \
+    {                                                                   \
+        return get ## NAME(findColumn(columnName));                     \
+    }
+
+GEN_INTEGER(Byte, char)
+GEN_INTEGER(Short, short)
+GEN_INTEGER(Int, int32_t)
+GEN_INTEGER(Long, int64_t)
+GEN_REAL(Float, float)
+GEN_REAL(Double, double)
+GEN_DATE_TIME(Date, Date, Date)
+GEN_DATE_TIME(Time, Time, Time)
+GEN_DATE_TIME(Timestamp, Timestamp, Timestamp)
+GEN_DATE_TIME(TimestampNoTZ, TimestampNoTZ, TimestampNoTZ)
+
+GEN_BY_NAME(Byte, char)
+GEN_BY_NAME(Boolean, bool)
+GEN_BY_NAME(Short, short)
+GEN_BY_NAME(Int, int32_t)
+GEN_BY_NAME(Long, int64_t)
+GEN_BY_NAME(Float, float)
+GEN_BY_NAME(Double, double)
+GEN_BY_NAME(Date, NuoDB::Date*)
+GEN_BY_NAME(Time, NuoDB::Time*)
+GEN_BY_NAME(Timestamp, NuoDB::Timestamp*)
+GEN_BY_NAME(TimestampNoTZ, NuoDB::TimestampNoTZ*)
+GEN_BY_NAME(Blob, NuoDB::Blob*)
+GEN_BY_NAME(Clob, NuoDB::Clob*)
+GEN_BY_NAME(Bytes, NuoDB::Bytes)
+
+// LOB and binary values are only there if they were staged with handles.
+GEN_OBJECT(Blob, NuoDB::Blob*, Blob)
+GEN_OBJECT(Clob, NuoDB::Clob*, Clob)
+
+NuoDB::Bytes StagedResultSet::getBytes(int column)
+{
+    StagedValue& value = getValue(column);
+    if (value.null || kinds[column - 1] != StagedKind::Bytes) {
+        return NuoDB::Bytes();
+    }
+    return NuoDB::Bytes((const unsigned char*)value.string.data(), (int)value.string.size());
+}
+
+#undef GEN_INTEGER
+#undef GEN_REAL
+#undef GEN_OBJECT
+#undef GEN_DATE_TIME
+#undef GEN_BY_NAME
+
+void StagedRowset::open(ResultSetMetaData* metaData, TimeZoneCache* timeZone, const std::vector<int>& stagedColumns,
+                        MemoryAccount* account)
+{
+    close();
+    view.reset(new StagedResultSet(metaData, timeZone, true));
+    columns = stagedColumns;
+    memory.attach(account, MemoryUse::Rowsets);
+}
+
+bool StagedRowset::hasColumn(int column) const
+{
+    return std::find(columns.begin(), columns.end(), column) != columns.end();
+}
+
+void StagedRowset::close()
+{
+    clear();
+    rows.clear();
+    columns.clear();
+    view.reset();
+}
+
+void StagedRowset::clear()
+{
+    for (size_t n = 0; n < count; ++n) {
+        view->releaseRow(rows[n]);
+    }
+    count = 0;
+    memory.force(0);
+}
+
+void StagedRowset::stage(ResultSet* base)
+{
+    if (count == rows.size()) {
+        rows.emplace_back();
+    }
+    view->stageRow(base, rows[count++], &columns);
+    memory.force(memory.get() + view->getSize(rows[count - 1]));
+}
+
+ResultSet* StagedRowset::getRow(size_t row)
+{
+    view->setRow(row < count ? &rows[row] : nullptr);
+    return view.get();
+}
@@ -0,0 +1,179 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DateTime.h"
+#include "MemoryAccount.h"
+#include "NuoRemote/Bytes.h"
+#include "NuoRemote/ResultSet.h"
+
+// How a column is staged: by the natural kind of its SQL type.
+enum class StagedKind : char
+{
+    Integer,
+    Real,
+    String,
+    Date,
+    Time,
+    Timestamp,
+    TimestampNoTZ,
+    Blob,
+    Clob,
+    Bytes,
+};
+
+// One column of a staged row.  Date/time and LOB values keep the client
+// object (and a reference on it), or for a date/time value without one,
+// its seconds in integer and its nanoseconds; binary values are copied
+// into string.
+struct StagedValue
+{
+    int64_t     integer = 0;
+    double      real = 0;
+    std::string string;
+    void*       object = nullptr;
+    int32_t     nanos = 0;
+    bool        null = false;
+    bool        formatted = false;  // string holds the text of a non-string value
+};
+
+typedef std::vector<StagedValue> StagedRow;
+
+/**
+ * A result set over rows copied out of another one.  stageRow() reads the
+ * current row of a base result set into a StagedRow, after which the row
+ * no longer depends on the base's cursor; setRow() points the getters at a
+ * staged row.  Rows are only read, apart from the text of a non-string
+ * value kept the first time it's asked for, so different rows can be read
+ * through different StagedResultSets on different threads.
+ *
+ * Only columns of numeric, character, and date/time types can be staged;
+ * see canStage().  A StagedResultSet made with handles also stages LOB
+ * columns, by keeping the client's handle, and binary columns; those rows
+ * must be read on the thread that staged them.
+ */
+class StagedResultSet : public NuoDB::ResultSet
+{
+public:
+    StagedResultSet(NuoDB::ResultSetMetaData* metaData, TimeZoneCache* timeZone, bool handles = false);
+    virtual ~StagedResultSet() = default;
+
+    static bool getKind(NuoDB::ResultSetMetaData* metaData, int column, StagedKind* kind, bool handles = false);
+    static bool canStage(NuoDB::ResultSetMetaData* metaData);
+
+    // Read the current row of base into row: every column, or only those
+    // listed.
+    void stageRow(NuoDB::ResultSet* base, StagedRow& row, const std::vector<int>* only = nullptr) const;
+    void releaseRow(StagedRow& row) const;
+    void setRow(StagedRow* staged) { row = staged; }
+
+    // About the bytes row takes, for a MemoryAccount.  The text kept for a
+    // non-string value isn't counted, so it's the same before and after.
+    size_t getSize(const StagedRow& row) const;
+
+    // A view on its own rows has no cursor and nothing to release.
+    virtual void addRef() {}
+    virtual int  release() { return 1; }
+    virtual void close() {}
+    virtual bool next() { return false; }
+    virtual bool wasNull();
+    virtual int  findColumn(const char* columName);
+
+    virtual NuoDB::ResultSetMetaData* getMetaData();
+
+    virtual const char*           getString(int columnIndex, int* n_chars);
+    virtual const char*           getString(int id);
+    virtual const char*           getString(const char* columnName);
+    virtual char                  getByte(int id);
+    virtual char                  getByte(const char* columnName);
+    virtual bool                  getBoolean(int id);
+    virtual bool                  getBoolean(const char* columnName);
+    virtual short                 getShort(int id);
+    virtual short                 getShort(const char* columnName);
+    virtual int32_t               getInt(int id);
+    virtual int32_t               getInt(const char* columnName);
+    virtual int64_t               getLong(int id);
+    virtual int64_t               getLong(const char* columnName);
+    virtual float                 getFloat(int id);
+    virtual float                 getFloat(const char* columnName);
+    virtual double                getDouble(int id);
+    virtual double                getDouble(const char* columnName);
+    virtual NuoDB::Date*          getDate(int id);
+    virtual NuoDB::Date*          getDate(const char* columnName);
+    virtual NuoDB::Time*          getTime(int id);
+    virtual NuoDB::Time*          getTime(const char* columnName);
+    virtual NuoDB::Timestamp*     getTimestamp(int id);
+    virtual NuoDB::Timestamp*     getTimestamp(const char* columnName);
+    virtual NuoDB::TimestampNoTZ* getTimestampNoTZ(int id);
+    virtual NuoDB::TimestampNoTZ* getTimestampNoTZ(const char* columnName);
+    virtual NuoDB::Blob*          getBlob(int index);
+    virtual NuoDB::Blob*          getBlob(const char* columnName);
+    virtual NuoDB::Clob*          getClob(int index);
+    virtual NuoDB::Clob*          getClob(const char* columnName);
+    virtual NuoDB::Bytes          getBytes(int index);
+    virtual NuoDB::Bytes          getBytes(const char* columnName);
+
+protected:
+    // With the kinds of the columns given rather than found from metaData.
+    StagedResultSet(NuoDB::ResultSetMetaData* metaData, TimeZoneCache* timeZone, const std::vector<StagedKind>& kinds);
+
+    NuoDB::ResultSetMetaData* metaData;
+    TimeZoneCache*            timeZone;
+    DateTime::DayMemo         memo;
+    std::vector<StagedKind>   kinds;
+
+private:
+    StagedValue& getValue(int column);
+    double       getReal(int column);
+    int64_t      getInteger(int column);
+    void         format(StagedValue& value, StagedKind kind);
+
+    StagedRow*                row = nullptr;
+    bool                      lastNull = false;
+};
+
+// The rows of the current rowset of a block cursor, the columns given of
+// each staged as it's fetched, so that SQLGetData can read them on any row
+// once SQLSetPos has positioned the cursor on it.  They're charged to
+// account, if there is one, regardless of its limit: how many there are is
+// up to the application's rowset size.
+class StagedRowset final
+{
+public:
+    bool   isOpen() const { return view != nullptr; }
+    void   open(NuoDB::ResultSetMetaData* metaData, TimeZoneCache* timeZone, const std::vector<int>& columns,
+                MemoryAccount* account = nullptr);
+    void   close();
+
+    const std::vector<int>& getColumns() const { return columns; }
+    bool   hasColumn(int column) const;
+
+    // Forget the rows, keeping their storage for the next rowset.
+    void   clear();
+
+    // Add the current row of base.
+    void   stage(NuoDB::ResultSet* base);
+
+    size_t getRowCount() const { return count; }
+
+    // A result set positioned on row (0 based) of the rowset.
+    NuoDB::ResultSet* getRow(size_t row);
+
+private:
+    std::unique_ptr<StagedResultSet> view;
+    std::vector<int>                 columns;
+    std::vector<StagedRow>           rows;
+    size_t                           count = 0;
+    MemoryCharge                     memory;
+};
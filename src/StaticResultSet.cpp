@@ -0,0 +1,99 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdint.h>
+
+#include "StaticResultSet.h"
+
+#include "NuoRemote/ResultSetMetaData.h"
+
+using namespace NuoDB;
+
+namespace STATIC_RESULT_SET {
+
+static std::vector<StagedKind> getKinds(ResultSetMetaData* metaData)
+{
+    std::vector<StagedKind> kinds(metaData->getColumnCount());
+    for (size_t n = 0; n < kinds.size(); ++n) {
+        StagedResultSet::getKind(metaData, (int)n + 1, &kinds[n], true);
+    }
+    return kinds;
+}
+
+} // namespace STATIC_RESULT_SET
+
+StaticResultSet::StaticResultSet(ResultSet* b, TimeZoneCache* zone, size_t memoryBudget, size_t rows, MemoryAccount* account)
+    : StaticResultSet(b, STATIC_RESULT_SET::getKinds(b->getMetaData()), zone, memoryBudget, rows, account)
+{
+}
+
+StaticResultSet::StaticResultSet(ResultSet* b, const std::vector<StagedKind>& columnKinds, TimeZoneCache* zone,
+                                 size_t memoryBudget, size_t rows, MemoryAccount* account)
+    : ScrollableResultSet(b->getMetaData(), zone, columnKinds),
+      base(b),
+      store(columnKinds, memoryBudget, nullptr, account),
+      maxRows(rows)
+{
+    base->addRef();
+}
+
+StaticResultSet::~StaticResultSet()
+{
+    base->release();
+}
+
+// Read rows from the base until there are at least rows of them, or it
+// runs out.
+void StaticResultSet::fill(size_t rows)
+{
+    while (!exhausted && store.getRowCount() < rows) {
+        if (maxRows > 0 && store.getRowCount() >= maxRows) {
+            // nothing more is wanted from the server's cursor
+            exhausted = true;
+            base->close();
+            break;
+        }
+        if (!base->next()) {
+            exhausted = true;
+            break;
+        }
+        store.append(base);
+    }
+}
+
+bool StaticResultSet::absolute(size_t row)
+{
+    if (row > 0) {
+        fill(row);
+    }
+
+    if (row == 0 || row > store.getRowCount()) {
+        position = row == 0 ? 0 : store.getRowCount() + 1;
+        setRow(nullptr);
+        return false;
+    }
+
+    store.read(row - 1, current);
+    setRow(&current);
+    position = row;
+    return true;
+}
+
+size_t StaticResultSet::getRowCount()
+{
+    fill(SIZE_MAX);
+    return store.getRowCount();
+}
+
+// Nothing more is read from the base; the rows already read stay.
+void StaticResultSet::close()
+{
+    if (!exhausted) {
+        exhausted = true;
+        base->close();
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "RowStore.h"
+#include "ScrollableResultSet.h"
+
+// The memory a static cursor keeps its rows in before it spills them.
+#define DEFAULT_CURSOR_MEMORY   (64 * 1024 * 1024)
+
+/**
+ * The result set behind a static cursor.  Rows of the base result set are
+ * copied into a RowStore as they're first reached, so the cursor can then
+ * move over them in either direction; going to the last row reads the rest
+ * of the base.  At most maxRows rows are kept, or all of them if it's 0.
+ * The memory they take is charged to account, if there is one.
+ */
+class StaticResultSet : public ScrollableResultSet
+{
+public:
+    StaticResultSet(NuoDB::ResultSet* base, TimeZoneCache* timeZone, size_t memoryBudget, size_t maxRows,
+                    MemoryAccount* account = nullptr);
+
+    // With the kinds of the base's columns given, for a base whose metadata
+    // isn't to be looked at.
+    StaticResultSet(NuoDB::ResultSet* base, const std::vector<StagedKind>& kinds, TimeZoneCache* timeZone,
+                    size_t memoryBudget, size_t maxRows, MemoryAccount* account = nullptr);
+    virtual ~StaticResultSet();
+
+    virtual bool   absolute(size_t row);
+    virtual size_t getRowCount();
+    virtual size_t getRowsRead() const { return store.getRowCount(); }
+
+    const RowStore& getStore() const { return store; }
+
+    virtual void close();
+
+private:
+    void   fill(size_t rows);
+
+    NuoDB::ResultSet* base;
+    RowStore          store;
+    StagedRow         current;
+    size_t            maxRows;
+    bool              exhausted = false;
+};
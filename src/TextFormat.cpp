@@ -0,0 +1,239 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdio.h>
+#include <charconv>
+
+#include "TextFormat.h"
+
+#include "HexCodec.h"
+#include "OdbcBase.h"
+#include "OdbcTypeMapper.h"
+
+#include "NuoRemote/DateClass.h"
+#include "NuoRemote/ResultSet.h"
+#include "NuoRemote/ResultSetMetaData.h"
+#include "NuoRemote/TimeClass.h"
+#include "NuoRemote/Timestamp.h"
+
+using namespace NuoDB;
+
+namespace TEXT_FORMAT {
+
+// Write value as exactly 'digits' digits.
+static char* putDigits(char* out, unsigned value, int digits)
+{
+    for (int n = digits - 1; n >= 0; --n) {
+        out[n] = (char)('0' + value % 10);
+        value /= 10;
+    }
+    return out + digits;
+}
+
+static char* putYear(char* out, int64_t year)
+{
+    if (year < 0) {
+        *out++ = '-';
+        year = -year;
+    }
+    if (year < 10000) {
+        return putDigits(out, (unsigned)year, 4);
+    }
+    return std::to_chars(out, out + 20, year).ptr;
+}
+
+static char* putDate(char* out, const DateTime::Fields& fields)
+{
+    out = putYear(out, fields.year);
+    *out++ = '-';
+    out = putDigits(out, fields.month, 2);
+    *out++ = '-';
+    return putDigits(out, fields.day, 2);
+}
+
+static char* putTime(char* out, const DateTime::Fields& fields)
+{
+    out = putDigits(out, fields.hour, 2);
+    *out++ = ':';
+    out = putDigits(out, fields.minute, 2);
+    *out++ = ':';
+    return putDigits(out, fields.second, 2);
+}
+
+static char* putTimestamp(char* out, const DateTime::Fields& fields, int32_t nanos)
+{
+    out = putDate(out, fields);
+    *out++ = ' ';
+    out = putTime(out, fields);
+
+    if (nanos > 0) {
+        // drop trailing zeros from the fraction
+        int digits = 9;
+        while (nanos % 10 == 0) {
+            nanos /= 10;
+            --digits;
+        }
+        *out++ = '.';
+        out = putDigits(out, (unsigned)nanos, digits);
+    }
+    return out;
+}
+
+} // namespace TEXT_FORMAT
+
+namespace TextFormat {
+
+using namespace TEXT_FORMAT;
+
+TextKind getTextKind(ResultSetMetaData* metaData, int column)
+{
+    int type = metaData->getColumnType(column);
+
+    switch ((int)OdbcTypeMapper::mapType(type)) {
+        case SQL_TINYINT:
+        case SQL_SMALLINT:
+        case SQL_INTEGER:
+        case SQL_BIGINT:
+            return TextKind::Integer;
+
+        case SQL_REAL:
+            return TextKind::Float;
+
+        case SQL_FLOAT:
+        case SQL_DOUBLE:
+            return TextKind::Double;
+
+        case SQL_DATE:
+        case SQL_TYPE_DATE:
+            return TextKind::Date;
+
+        case SQL_TIME:
+        case SQL_TYPE_TIME:
+            return TextKind::Time;
+
+        case SQL_TIMESTAMP:
+        case SQL_TYPE_TIMESTAMP:
+            return DateTime::isWithoutTimeZone(metaData->getColumnTypeName(column)) ? TextKind::TimestampNoTZ : TextKind::Timestamp;
+
+        default:
+            return TextKind::None;
+    }
+}
+
+int formatColumn(ResultSet* results, int column, TextKind kind, TimeZoneCache* timeZone, char* out, DateTime::DayMemo* memo)
+{
+    int              length = 0;
+    DateTime::Fields fields;
+
+    switch (kind) {
+        case TextKind::Integer:
+            length = formatInteger(results->getLong(column), out);
+            break;
+
+        case TextKind::Float:
+            length = formatFloat(results->getFloat(column), out);
+            break;
+
+        case TextKind::Double:
+            length = formatDouble(results->getDouble(column), out);
+            break;
+
+        case TextKind::Date: {
+            Date* date = results->getDate(column);
+            if (!date) {
+                return -1;
+            }
+            timeZone->toLocal(date->getSeconds(), &fields, memo);
+            date->release();
+            length = formatDate(fields, out);
+            break;
+        }
+
+        case TextKind::Time: {
+            Time* time = results->getTime(column);
+            if (!time) {
+                return -1;
+            }
+            timeZone->toLocal(time->getSeconds(), &fields, memo);
+            time->release();
+            length = formatTime(fields, out);
+            break;
+        }
+
+        case TextKind::Timestamp: {
+            Timestamp* timestamp = results->getTimestamp(column);
+            if (!timestamp) {
+                return -1;
+            }
+            timeZone->toLocal(timestamp->getSeconds(), &fields, memo);
+            length = formatTimestamp(fields, timestamp->getNanos(), out);
+            timestamp->release();
+            break;
+        }
+
+        case TextKind::TimestampNoTZ: {
+            TimestampNoTZ* timestamp = results->getTimestampNoTZ(column);
+            if (!timestamp) {
+                return -1;
+            }
+            DateTime::fromSeconds(timestamp->getSeconds(), &fields);
+            length = formatTimestamp(fields, timestamp->getNanos(), out);
+            timestamp->release();
+            break;
+        }
+
+        case TextKind::None:
+            return -1;
+    }
+
+    return results->wasNull() ? -1 : length;
+}
+
+int formatInteger(int64_t value, char* out)
+{
+    return (int)(std::to_chars(out, out + TEXT_FORMAT_MAX, value).ptr - out);
+}
+
+int formatFloat(float value, char* out)
+{
+#ifdef NUOODBC_FLOAT_TO_CHARS
+    return (int)(std::to_chars(out, out + TEXT_FORMAT_MAX, value).ptr - out);
+#else
+    return snprintf(out, TEXT_FORMAT_MAX, "%.9g", (double)value);
+#endif
+}
+
+int formatDouble(double value, char* out)
+{
+#ifdef NUOODBC_FLOAT_TO_CHARS
+    return (int)(std::to_chars(out, out + TEXT_FORMAT_MAX, value).ptr - out);
+#else
+    return snprintf(out, TEXT_FORMAT_MAX, "%.17g", value);
+#endif
+}
+
+int formatDate(const DateTime::Fields& fields, char* out)
+{
+    return (int)(putDate(out, fields) - out);
+}
+
+int formatTime(const DateTime::Fields& fields, char* out)
+{
+    return (int)(putTime(out, fields) - out);
+}
+
+int formatTimestamp(const DateTime::Fields& fields, int32_t nanos, char* out)
+{
+    return (int)(putTimestamp(out, fields, nanos) - out);
+}
+
+void formatHex(const uint8_t* in, size_t length, char* out)
+{
+    HexCodec::encode(in, length, out);
+}
+
+}
@@ -0,0 +1,64 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "DateTime.h"
+
+namespace NuoDB {
+class ResultSet;
+class ResultSetMetaData;
+}
+
+// The text of typed values, written by the driver rather than asked of the
+// client with getString: the client formats each value into a string it
+// allocates, while here the native value is written into a caller's buffer
+// with std::to_chars (shortest round trip for floating point) and ISO 8601
+// writers for dates and times.  A compiler without floating point to_chars
+// (GCC before 11) writes REAL and DOUBLE with snprintf "%.9g" and "%.17g"
+// instead: they read back the same, but don't always have the fewest digits.
+namespace TextFormat {
+
+// Enough for any value written here.
+#define TEXT_FORMAT_MAX 64
+
+// How a column's value is read and written.  None: the column is left to
+// getString.
+enum class TextKind : char
+{
+    None,
+    Integer,
+    Float,
+    Double,
+    Date,
+    Time,
+    Timestamp,
+    TimestampNoTZ,
+};
+
+TextKind getTextKind(NuoDB::ResultSetMetaData* metaData, int column);
+
+// Write the value of column in the current row, returning its length, or -1
+// if it's NULL.  memo, if given, is the caller's for the dates it formats.
+int      formatColumn(NuoDB::ResultSet* results, int column, TextKind kind, TimeZoneCache* timeZone, char* out,
+                  DateTime::DayMemo* memo = nullptr);
+
+// The writers, each returning the length written.
+int      formatInteger(int64_t value, char* out);
+int      formatFloat(float value, char* out);
+int      formatDouble(double value, char* out);
+int      formatDate(const DateTime::Fields& fields, char* out);                  // YYYY-MM-DD
+int      formatTime(const DateTime::Fields& fields, char* out);                  // hh:mm:ss
+int      formatTimestamp(const DateTime::Fields& fields, int32_t nanos, char* out); // YYYY-MM-DD hh:mm:ss[.f]
+
+// Two upper case hex digits for each of length bytes at in.
+void     formatHex(const uint8_t* in, size_t length, char* out);
+
+}
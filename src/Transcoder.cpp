@@ -0,0 +1,381 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "Transcoder.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+# define TRANSCODER_SSE2
+# if defined(_MSC_VER) || defined(__GNUC__)
+#  define TRANSCODER_AVX2
+# endif
+#elif defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define TRANSCODER_SSE2
+#endif
+
+#ifdef TRANSCODER_SSE2
+# include <immintrin.h>
+# ifdef _MSC_VER
+#  include <intrin.h>
+# endif
+#endif
+
+#if defined(TRANSCODER_AVX2) && defined(__GNUC__)
+# define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+# define TARGET_AVX2
+#endif
+
+namespace TRANSCODER {
+
+// Widen the ASCII bytes at the start of in (up to length) into out.
+// Returns the number of bytes handled.
+typedef size_t (*WidenKernel)(const uint8_t* in, size_t length, char16_t* out);
+
+// Return the number of ASCII bytes at the start of in (up to length).
+typedef size_t (*SkipKernel)(const uint8_t* in, size_t length);
+
+struct Kernels
+{
+    WidenKernel widen;
+    SkipKernel  skip;
+    const char* name;
+};
+
+static size_t widenScalar(const uint8_t* in, size_t length, char16_t* out)
+{
+    size_t n = 0;
+    for (; n < length && in[n] < 0x80; ++n) {
+        out[n] = in[n];
+    }
+    return n;
+}
+
+static size_t skipScalar(const uint8_t* in, size_t length)
+{
+    size_t n = 0;
+    while (n < length && in[n] < 0x80) {
+        ++n;
+    }
+    return n;
+}
+
+#ifdef TRANSCODER_SSE2
+
+static size_t widenSse2(const uint8_t* in, size_t length, char16_t* out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t        n = 0;
+
+    for (; n + 16 <= length; n += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(in + n));
+        if (_mm_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm_storeu_si128((__m128i*)(out + n), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)(out + n + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+
+    return n + widenScalar(in + n, length - n, out + n);
+}
+
+static size_t skipSse2(const uint8_t* in, size_t length)
+{
+    size_t n = 0;
+
+    for (; n + 16 <= length; n += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(in + n)))) {
+            break;
+        }
+    }
+
+    return n + skipScalar(in + n, length - n);
+}
+
+#endif
+
+#ifdef TRANSCODER_AVX2
+
+TARGET_AVX2 static size_t widenAvx2(const uint8_t* in, size_t length, char16_t* out)
+{
+    size_t n = 0;
+
+    for (; n + 32 <= length; n += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(in + n));
+        if (_mm256_movemask_epi8(bytes)) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i*)(out + n), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+        _mm256_storeu_si256((__m256i*)(out + n + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+    }
+
+    return n + widenSse2(in + n, length - n, out + n);
+}
+
+TARGET_AVX2 static size_t skipAvx2(const uint8_t* in, size_t length)
+{
+    size_t n = 0;
+
+    for (; n + 32 <= length; n += 32) {
+        if (_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(in + n)))) {
+            break;
+        }
+    }
+
+    return n + skipSse2(in + n, length - n);
+}
+
+static bool hasAvx2()
+{
+# ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    // the OS has to save the AVX registers as well
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+# else
+    return __builtin_cpu_supports("avx2");
+# endif
+}
+
+#endif
+
+static Kernels selectKernels()
+{
+#ifdef TRANSCODER_AVX2
+    if (hasAvx2()) {
+        return { widenAvx2, skipAvx2, "avx2" };
+    }
+#endif
+#ifdef TRANSCODER_SSE2
+    return { widenSse2, skipSse2, "sse2" };
+#else
+    return { widenScalar, skipScalar, "scalar" };
+#endif
+}
+
+static Kernels kernels = selectKernels();
+
+// Decode the multi-byte sequence at in.  Returns its length, or 0 if it
+// isn't valid UTF-8.
+static size_t decode(const uint8_t* in, size_t length, uint32_t* codePoint)
+{
+    uint8_t  lead = in[0];
+    size_t   size;
+    uint32_t value;
+    uint32_t minimum;
+
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        size = 2;
+        value = lead & 0x1F;
+        minimum = 0x80;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        size = 3;
+        value = lead & 0x0F;
+        minimum = 0x800;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        size = 4;
+        value = lead & 0x07;
+        minimum = 0x10000;
+    } else {
+        return 0;
+    }
+
+    if (size > length) {
+        return 0;
+    }
+
+    for (size_t n = 1; n < size; ++n) {
+        if ((in[n] & 0xC0) != 0x80) {
+            return 0;
+        }
+        value = (value << 6) | (in[n] & 0x3F);
+    }
+
+    if (value < minimum || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+        return 0;
+    }
+
+    *codePoint = value;
+    return size;
+}
+
+// Whether the bytes at in are the start of a valid-looking sequence that
+// runs past length.
+static bool isCutOff(const uint8_t* in, size_t length)
+{
+    uint8_t lead = in[0];
+    size_t  size = (lead >= 0xC2 && lead <= 0xDF) ? 2 : (lead >= 0xE0 && lead <= 0xEF) ? 3 : (lead >= 0xF0 && lead <= 0xF4) ? 4 : 0;
+
+    if (length >= size) {
+        return false;
+    }
+    for (size_t n = 1; n < length; ++n) {
+        if ((in[n] & 0xC0) != 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace TRANSCODER
+
+namespace Transcoder {
+
+using namespace TRANSCODER;
+
+bool utf8ToUtf16(const char* input, size_t length, char16_t* out, size_t capacity, size_t* written, size_t* required)
+{
+    const uint8_t* in = (const uint8_t*)input;
+    size_t         pos = 0;
+    size_t         units = 0;
+    uint32_t       codePoint;
+
+    // Store as much as fits...
+    while (pos < length && units < capacity) {
+        size_t ascii = kernels.widen(in + pos, std::min(length - pos, capacity - units), out + units);
+        pos += ascii;
+        units += ascii;
+        if (pos == length || units == capacity) {
+            break;
+        }
+
+        size_t size = decode(in + pos, length - pos, &codePoint);
+        if (!size) {
+            return false;
+        }
+
+        if (codePoint < 0x10000) {
+            out[units++] = (char16_t)codePoint;
+        } else if (units + 2 <= capacity) {
+            codePoint -= 0x10000;
+            out[units++] = (char16_t)(0xD800 + (codePoint >> 10));
+            out[units++] = (char16_t)(0xDC00 + (codePoint & 0x3FF));
+        } else {
+            break;
+        }
+        pos += size;
+    }
+
+    *written = units;
+
+    // ...then measure (and validate) the rest.
+    while (pos < length) {
+        size_t ascii = kernels.skip(in + pos, length - pos);
+        pos += ascii;
+        units += ascii;
+        if (pos == length) {
+            break;
+        }
+
+        size_t size = decode(in + pos, length - pos, &codePoint);
+        if (!size) {
+            return false;
+        }
+        units += codePoint < 0x10000 ? 1 : 2;
+        pos += size;
+    }
+
+    *required = units;
+    return true;
+}
+
+bool utf8ToUtf16(const char* in, size_t length, std::u16string& out)
+{
+    size_t written;
+    size_t required;
+
+    // UTF-16 never needs more code units than UTF-8 needs bytes
+    out.resize(length);
+    if (!utf8ToUtf16(in, length, &out[0], length, &written, &required)) {
+        out.clear();
+        return false;
+    }
+    out.resize(written);
+    return true;
+}
+
+bool utf8ToUtf16Piece(const char* input, size_t length, char16_t* out, size_t capacity,
+                      size_t* consumed, size_t* written, char16_t* pending)
+{
+    const uint8_t* in = (const uint8_t*)input;
+    size_t         pos = 0;
+    size_t         units = 0;
+    uint32_t       codePoint;
+
+    *pending = 0;
+
+    while (pos < length && units < capacity) {
+        size_t ascii = kernels.widen(in + pos, std::min(length - pos, capacity - units), out + units);
+        pos += ascii;
+        units += ascii;
+        if (pos == length || units == capacity) {
+            break;
+        }
+
+        size_t size = decode(in + pos, length - pos, &codePoint);
+        if (!size) {
+            if (isCutOff(in + pos, length - pos)) {
+                break;
+            }
+            return false;
+        }
+
+        if (codePoint < 0x10000) {
+            out[units++] = (char16_t)codePoint;
+        } else {
+            codePoint -= 0x10000;
+            out[units++] = (char16_t)(0xD800 + (codePoint >> 10));
+            char16_t low = (char16_t)(0xDC00 + (codePoint & 0x3FF));
+            if (units < capacity) {
+                out[units++] = low;
+            } else {
+                *pending = low;
+            }
+        }
+        pos += size;
+    }
+
+    *consumed = pos;
+    *written = units;
+    return true;
+}
+
+const char* getKernelName()
+{
+    return kernels.name;
+}
+
+bool useKernel(const char* name)
+{
+    if (!strcmp(name, "scalar")) {
+        kernels = { widenScalar, skipScalar, "scalar" };
+        return true;
+    }
+#ifdef TRANSCODER_SSE2
+    if (!strcmp(name, "sse2")) {
+        kernels = { widenSse2, skipSse2, "sse2" };
+        return true;
+    }
+#endif
+#ifdef TRANSCODER_AVX2
+    if (!strcmp(name, "avx2") && hasAvx2()) {
+        kernels = { widenAvx2, skipAvx2, "avx2" };
+        return true;
+    }
+#endif
+    return false;
+}
+
+}
@@ -0,0 +1,45 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+// UTF-8 to UTF-16 conversion for SQL_C_WCHAR.  Runs of ASCII are widened
+// with SSE2 or AVX2 when the CPU has them; the rest is decoded one code
+// point at a time.  Input is validated in the same pass: overlong forms,
+// surrogates and code points past U+10FFFF are rejected.
+namespace Transcoder {
+
+// Convert length bytes of UTF-8 at in, storing at most capacity UTF-16 code
+// units at out; a surrogate pair is never split.  *written is set to the
+// number of units stored and *required to the number of units in the whole
+// value.  Returns false if the input is not valid UTF-8.
+bool utf8ToUtf16(const char* in, size_t length, char16_t* out, size_t capacity, size_t* written, size_t* required);
+
+// Convert the whole value into out.
+bool utf8ToUtf16(const char* in, size_t length, std::u16string& out);
+
+// Convert one piece of a longer value, read a piece at a time: as much of
+// in as fits in capacity units at out.  A sequence cut off at the end of in
+// is left unconsumed for the next piece.  When there's room for only the
+// first half of a surrogate pair, the high surrogate is stored and the low
+// one returned in *pending (otherwise 0) for the caller to store next.
+// Sets *consumed to the bytes used and *written to the units stored.
+bool utf8ToUtf16Piece(const char* in, size_t length, char16_t* out, size_t capacity,
+                      size_t* consumed, size_t* written, char16_t* pending);
+
+// The name of the kernel picked for this CPU, for tracing.
+const char* getKernelName();
+
+// Use the kernel named, "scalar", "sse2" or "avx2", rather than the one
+// picked, so that tests can compare them; false if this CPU can't run it.
+// Only while nothing is being converted.
+bool useKernel(const char* name);
+
+}
@@ -0,0 +1,120 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <algorithm>
+
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(int count)
+{
+    for (int n = 0; n < count; ++n) {
+        threads.emplace_back(&WorkerPool::work, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    queued.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::run(int count, const std::function<void(int)>& task)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+
+    if (count > 1 && !threads.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(&job);
+        }
+        queued.notify_all();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    int index;
+    while (claim(job, &index)) {
+        lock.unlock();
+        perform(job, index);
+        lock.lock();
+    }
+
+    finished.wait(lock, [&job] { return job.finished == job.count; });
+
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+// Take the next task of job; a job whose tasks are all taken leaves the
+// queue.  Called with the mutex held.
+bool WorkerPool::claim(Job& job, int* index)
+{
+    if (job.next == job.count) {
+        return false;
+    }
+
+    *index = job.next++;
+    if (job.next == job.count) {
+        auto position = std::find(jobs.begin(), jobs.end(), &job);
+        if (position != jobs.end()) {
+            jobs.erase(position);
+        }
+    }
+    return true;
+}
+
+void WorkerPool::perform(Job& job, int index)
+{
+    std::exception_ptr error;
+    try {
+        (*job.task)(index);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (error && !job.error) {
+        job.error = error;
+    }
+    if (++job.finished == job.count) {
+        finished.notify_all();
+    }
+}
+
+void WorkerPool::work()
+{
+    for (;;) {
+        Job* job;
+        int  index;
+        {
+            // the job can't finish while one of its tasks is unclaimed, so
+            // it has to be claimed before the lock is let go
+            std::unique_lock<std::mutex> lock(mutex);
+            queued.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                return;
+            }
+            job = jobs.front();
+            claim(*job, &index);
+        }
+
+        perform(*job, index);
+    }
+}
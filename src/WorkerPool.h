@@ -0,0 +1,57 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small pool of threads shared by the statements of an environment, for
+// work that splits into independent tasks.  The caller of run() works on
+// its own tasks too, so a job finishes even while the workers are busy
+// with another statement's.
+class WorkerPool final
+{
+public:
+    explicit WorkerPool(int threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int  getThreadCount() const { return (int)threads.size(); }
+
+    // Run task(0) to task(count - 1) and return once all of them are done.
+    // The first exception thrown by a task is rethrown here.
+    void run(int count, const std::function<void(int)>& task);
+
+private:
+    struct Job
+    {
+        const std::function<void(int)>* task;
+        int                count;
+        int                next = 0;
+        int                finished = 0;
+        std::exception_ptr error;
+    };
+
+    void work();
+    bool claim(Job& job, int* index);   // with the mutex held
+    void perform(Job& job, int index);
+
+    std::mutex               mutex;
+    std::condition_variable  queued;
+    std::condition_variable  finished;
+    std::deque<Job*>         jobs;
+    std::vector<std::thread> threads;
+    bool                     stopping = false;
+};
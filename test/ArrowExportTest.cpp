@@ -0,0 +1,163 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ArrowExport.h"
+#include "FakeResultSet.h"
+
+using namespace ArrowExport;
+
+static ArrowColumn column(ArrowKind kind, const char* name, const char* format, int scale = 0)
+{
+    ArrowColumn arrow;
+    arrow.kind = kind;
+    arrow.name = name;
+    arrow.format = format;
+    arrow.scale = scale;
+    return arrow;
+}
+
+static bool isValid(const ArrowArray* array, int64_t row)
+{
+    const uint8_t* validity = (const uint8_t*)array->buffers[0];
+    return !validity || (validity[row / 8] >> (row % 8)) & 1;
+}
+
+template <typename T>
+static T valueAt(const ArrowArray* array, int64_t row)
+{
+    T value;
+    memcpy(&value, (const char*)array->buffers[1] + row * sizeof(T), sizeof(T));
+    return value;
+}
+
+static std::string stringAt(const ArrowArray* array, int64_t row)
+{
+    const int64_t* offsets = (const int64_t*)array->buffers[1];
+    return std::string((const char*)array->buffers[2] + offsets[row], (size_t)(offsets[row + 1] - offsets[row]));
+}
+
+class ArrowExportTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        columns = {
+            column(ArrowKind::Int32, "ID", "i"),
+            column(ArrowKind::Int64, "COUNT", "l"),
+            column(ArrowKind::Double, "RATIO", "g"),
+            column(ArrowKind::Boolean, "FLAG", "b"),
+            column(ArrowKind::String, "NAME", "U"),
+            column(ArrowKind::Decimal, "PRICE", "d:10,2", 2),
+        };
+        std::vector<StagedKind> kinds = {
+            StagedKind::Integer, StagedKind::Integer, StagedKind::Real, StagedKind::Integer, StagedKind::String, StagedKind::String,
+        };
+        std::vector<StagedRow> rows = {
+            { integer(1), integer(10000000000), real(0.5), integer(1), text("one"), text("12.34") },
+            { integer(2), null(), real(1.5), integer(0), text(""), text("-12.5") },
+            { integer(3), integer(-1), null(), null(), null(), null() },
+            { integer(4), integer(4), real(-2), integer(1), text("\xc3\xa9t\xc3\xa9"), text("7") },
+            { integer(5), integer(5), real(0), integer(0), text("five"), text("0.129") },
+        };
+        results.reset(new FakeResultSet(kinds, std::move(rows)));
+    }
+
+    std::vector<ArrowColumn>       columns;
+    std::unique_ptr<FakeResultSet> results;
+};
+
+TEST_F(ArrowExportTest, Schema)
+{
+    ArrowSchema schema;
+    exportSchema(columns, &schema);
+
+    EXPECT_STREQ("+s", schema.format);
+    ASSERT_EQ((int64_t)columns.size(), schema.n_children);
+    for (size_t n = 0; n < columns.size(); ++n) {
+        EXPECT_STREQ(columns[n].format.c_str(), schema.children[n]->format);
+        EXPECT_STREQ(columns[n].name.c_str(), schema.children[n]->name);
+        EXPECT_EQ(ARROW_FLAG_NULLABLE, schema.children[n]->flags);
+    }
+
+    // a child moved out lives on after its parent
+    ArrowSchema moved = *schema.children[4];
+    schema.children[4]->release = nullptr;
+    schema.release(&schema);
+    EXPECT_EQ(nullptr, schema.release);
+    EXPECT_STREQ("NAME", moved.name);
+    moved.release(&moved);
+}
+
+TEST_F(ArrowExportTest, Batches)
+{
+    ArrowArray batch;
+    ASSERT_EQ((size_t)3, exportBatch(results.get(), columns, nullptr, 3, &batch));
+    ASSERT_EQ(3, batch.length);
+    ASSERT_EQ((int64_t)columns.size(), batch.n_children);
+
+    ArrowArray* ids = batch.children[0];
+    EXPECT_EQ(0, ids->null_count);
+    EXPECT_EQ(nullptr, ids->buffers[0]);
+    EXPECT_EQ(1, valueAt<int32_t>(ids, 0));
+    EXPECT_EQ(3, valueAt<int32_t>(ids, 2));
+
+    ArrowArray* counts = batch.children[1];
+    EXPECT_EQ(1, counts->null_count);
+    EXPECT_TRUE(isValid(counts, 0));
+    EXPECT_FALSE(isValid(counts, 1));
+    EXPECT_EQ(10000000000, valueAt<int64_t>(counts, 0));
+    EXPECT_EQ(-1, valueAt<int64_t>(counts, 2));
+
+    ArrowArray* ratios = batch.children[2];
+    EXPECT_EQ(1.5, valueAt<double>(ratios, 1));
+    EXPECT_FALSE(isValid(ratios, 2));
+
+    ArrowArray* flags = batch.children[3];
+    const uint8_t* bits = (const uint8_t*)flags->buffers[1];
+    EXPECT_EQ(1, bits[0] & 1);
+    EXPECT_EQ(0, bits[0] & 2);
+    EXPECT_FALSE(isValid(flags, 2));
+
+    ArrowArray* names = batch.children[4];
+    EXPECT_EQ(3, names->n_buffers);
+    EXPECT_EQ("one", stringAt(names, 0));
+    EXPECT_EQ("", stringAt(names, 1));
+    EXPECT_TRUE(isValid(names, 1));
+    EXPECT_FALSE(isValid(names, 2));
+    EXPECT_EQ("", stringAt(names, 2));
+
+    // decimal128: two's complement, least significant word first
+    ArrowArray* prices = batch.children[5];
+    const uint64_t* words = (const uint64_t*)prices->buffers[1];
+    EXPECT_EQ((uint64_t)1234, words[0]);
+    EXPECT_EQ((uint64_t)0, words[1]);
+    EXPECT_EQ((uint64_t)-1250, words[2]);
+    EXPECT_EQ(~(uint64_t)0, words[3]);
+
+    batch.release(&batch);
+    EXPECT_EQ(nullptr, batch.release);
+
+    // the rest, and then nothing
+    ASSERT_EQ((size_t)2, exportBatch(results.get(), columns, nullptr, 3, &batch));
+    EXPECT_EQ("\xc3\xa9t\xc3\xa9", stringAt(batch.children[4], 0));
+    words = (const uint64_t*)batch.children[5]->buffers[1];
+    EXPECT_EQ((uint64_t)700, words[0]);
+    EXPECT_EQ((uint64_t)12, words[2]);
+    batch.release(&batch);
+
+    batch.release = nullptr;
+    EXPECT_EQ((size_t)0, exportBatch(results.get(), columns, nullptr, 3, &batch));
+    EXPECT_EQ(nullptr, batch.release);
+}
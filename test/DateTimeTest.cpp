@@ -0,0 +1,196 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <time.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DateTime.h"
+
+#define SECONDS_PER_DAY 86400
+
+static void expectFields(const struct tm& expected, const DateTime::Fields& fields, int64_t seconds)
+{
+    ASSERT_EQ(expected.tm_year + 1900, fields.year) << seconds;
+    ASSERT_EQ((unsigned)expected.tm_mon + 1, fields.month) << seconds;
+    ASSERT_EQ((unsigned)expected.tm_mday, fields.day) << seconds;
+    ASSERT_EQ((unsigned)expected.tm_hour, fields.hour) << seconds;
+    ASSERT_EQ((unsigned)expected.tm_min, fields.minute) << seconds;
+    ASSERT_EQ((unsigned)expected.tm_sec, fields.second) << seconds;
+}
+
+// Seconds from 1901 to 2100, at uneven steps, so that most times of day
+// are seen; then every quarter hour of the days around each of this year's
+// DST changes in the zones tested.
+static std::vector<int64_t> makeTimes()
+{
+    std::vector<int64_t> times;
+    for (int64_t seconds = -2147483647LL; seconds < 4102444800LL; seconds += 1234567) {
+        times.push_back(seconds);
+    }
+    for (int64_t day : { 20520, 20758, 20730, 20548 }) {   // 2026-03-08, 11-01, 10-04, 04-05
+        for (int64_t seconds = (day - 1) * SECONDS_PER_DAY; seconds < (day + 2) * SECONDS_PER_DAY; seconds += 900) {
+            times.push_back(seconds);
+            times.push_back(seconds + 1);
+        }
+    }
+    return times;
+}
+
+TEST(DateTimeTest, DaysFromCivil)
+{
+    EXPECT_EQ(0, DateTime::daysFromCivil(1970, 1, 1));
+    EXPECT_EQ(-1, DateTime::daysFromCivil(1969, 12, 31));
+    EXPECT_EQ(11016, DateTime::daysFromCivil(2000, 2, 29));
+    EXPECT_EQ(-719468, DateTime::daysFromCivil(0, 3, 1));
+
+    // against gmtime_r, and back again
+    for (int64_t days = -80000; days <= 80000; days += 7) {
+        int64_t  year;
+        unsigned month;
+        unsigned day;
+        DateTime::civilFromDays(days, &year, &month, &day);
+
+        struct tm expected;
+        time_t    seconds = (time_t)(days * SECONDS_PER_DAY);
+        gmtime_r(&seconds, &expected);
+        ASSERT_EQ(expected.tm_year + 1900, year) << days;
+        ASSERT_EQ((unsigned)expected.tm_mon + 1, month) << days;
+        ASSERT_EQ((unsigned)expected.tm_mday, day) << days;
+
+        ASSERT_EQ(days, DateTime::daysFromCivil(year, month, day)) << days;
+    }
+
+    // far from the epoch, either side of the 400 year cycle
+    for (int64_t days = -5000000; days <= 5000000; days += 146097 / 4 + 1) {
+        int64_t  year;
+        unsigned month;
+        unsigned day;
+        DateTime::civilFromDays(days, &year, &month, &day);
+        ASSERT_EQ(days, DateTime::daysFromCivil(year, month, day)) << days;
+    }
+}
+
+TEST(DateTimeTest, FromSeconds)
+{
+    for (int64_t seconds : makeTimes()) {
+        DateTime::Fields fields;
+        DateTime::fromSeconds(seconds, &fields);
+
+        struct tm expected;
+        time_t    time = (time_t)seconds;
+        gmtime_r(&time, &expected);
+        expectFields(expected, fields, seconds);
+    }
+}
+
+TEST(DateTimeTest, IsWithoutTimeZone)
+{
+    EXPECT_TRUE(DateTime::isWithoutTimeZone("TIMESTAMP WITHOUT TIME ZONE"));
+    EXPECT_TRUE(DateTime::isWithoutTimeZone("timestamp without time zone"));
+    EXPECT_FALSE(DateTime::isWithoutTimeZone("TIMESTAMP"));
+    EXPECT_FALSE(DateTime::isWithoutTimeZone("TIMESTAMP WITH TIME ZONE"));
+    EXPECT_FALSE(DateTime::isWithoutTimeZone(""));
+    EXPECT_FALSE(DateTime::isWithoutTimeZone(nullptr));
+}
+
+// TimeZoneCache against localtime_r, in each zone given as TZ, with the
+// one the process had put back afterwards.  POSIX rules are used so the
+// test doesn't need the zone database installed.
+class TimeZoneCacheTest : public ::testing::TestWithParam<const char*>
+{
+protected:
+    void SetUp() override
+    {
+        const char* zone = getenv("TZ");
+        hadZone = zone != nullptr;
+        savedZone = zone ? zone : "";
+        setenv("TZ", GetParam(), 1);
+        tzset();
+    }
+
+    void TearDown() override
+    {
+        if (hadZone) {
+            setenv("TZ", savedZone.c_str(), 1);
+        } else {
+            unsetenv("TZ");
+        }
+        tzset();
+    }
+
+    bool        hadZone = false;
+    std::string savedZone;
+};
+
+TEST_P(TimeZoneCacheTest, ToLocal)
+{
+    auto              cache = std::make_unique<TimeZoneCache>();
+    DateTime::DayMemo memo;
+
+    // twice over, the second time from the cache; with and without a memo
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int64_t seconds : makeTimes()) {
+            struct tm expected;
+            time_t    time = (time_t)seconds;
+            localtime_r(&time, &expected);
+
+            DateTime::Fields fields;
+            cache->toLocal(seconds, &fields, pass ? &memo : nullptr);
+            expectFields(expected, fields, seconds);
+        }
+    }
+}
+
+TEST_P(TimeZoneCacheTest, SharedByThreads)
+{
+    std::vector<int64_t>   times = makeTimes();
+    std::vector<struct tm> expected(times.size());
+    for (size_t n = 0; n < times.size(); ++n) {
+        time_t time = (time_t)times[n];
+        localtime_r(&time, &expected[n]);
+    }
+
+    // more days than the cache has slots, so that threads replace each
+    // other's days while they read them
+    auto                     cache = std::make_unique<TimeZoneCache>();
+    std::vector<std::thread> threads;
+    std::vector<size_t>      wrong(4, 0);
+    for (size_t thread = 0; thread < wrong.size(); ++thread) {
+        threads.emplace_back([&, thread] {
+            DateTime::DayMemo memo;
+            for (size_t n = thread; n < times.size(); n += wrong.size()) {
+                DateTime::Fields fields;
+                cache->toLocal(times[n], &fields, &memo);
+                if (fields.year != expected[n].tm_year + 1900 || fields.month != (unsigned)expected[n].tm_mon + 1 ||
+                    fields.day != (unsigned)expected[n].tm_mday || fields.hour != (unsigned)expected[n].tm_hour ||
+                    fields.minute != (unsigned)expected[n].tm_min || fields.second != (unsigned)expected[n].tm_sec) {
+                    ++wrong[thread];
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t thread = 0; thread < wrong.size(); ++thread) {
+        EXPECT_EQ((size_t)0, wrong[thread]) << thread;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Zones, TimeZoneCacheTest,
+                         ::testing::Values("UTC0",
+                                           "EST5EDT,M3.2.0,M11.1.0",
+                                           "AEST-10AEDT,M10.1.0,M4.1.0/3",
+                                           "LHST-10:30LHDT-11,M10.1.0,M4.1.0",
+                                           "IST-5:30"));
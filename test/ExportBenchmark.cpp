@@ -0,0 +1,178 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+// NuoODBCExport against the loop an application runs without it: each
+// column of each row fetched as text into a bound buffer, and the row
+// written once it's put together.  Both read a result set made up here, so
+// only the driver's side of the work is timed; its rows come round again,
+// and the text of a number is only made the first time, which flatters the
+// loop.
+//
+//     NuoODBCBenchmark [rows] [output file]
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+# include <io.h>
+# define NULL_DEVICE "NUL"
+#else
+# include <unistd.h>
+# define NULL_DEVICE "/dev/null"
+#endif
+
+#include "FakeResultSet.h"
+#include "ResultExport.h"
+
+#define POOL_ROWS   1024
+#define BOUND_SIZE  256     // the buffer bound for each column
+
+// A result set of rows taken in turn from a small pool.
+class RepeatingResultSet : public StagedResultSet
+{
+public:
+    RepeatingResultSet(const std::vector<StagedKind>& kinds, std::vector<StagedRow>&& rows, size_t count)
+        : StagedResultSet(nullptr, nullptr, kinds),
+          pool(std::move(rows)),
+          count(count)
+    {}
+
+    virtual bool next()
+    {
+        if (current == count) {
+            setRow(nullptr);
+            return false;
+        }
+        setRow(&pool[current++ % pool.size()]);
+        return true;
+    }
+
+    void rewind() { current = 0; }
+
+private:
+    std::vector<StagedRow> pool;
+    size_t                 count;
+    size_t                 current = 0;
+};
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, size_t rows, double elapsed)
+{
+    printf("%-24s %10zu rows %8.3f s %12.0f rows/s\n", name, rows, elapsed, rows / elapsed);
+}
+
+// SQLFetch with each column bound as SQL_C_CHAR, then a write per row.
+static size_t fetchByCell(RepeatingResultSet& results, int columns, int fd)
+{
+    std::vector<char> bound(columns * BOUND_SIZE);
+    std::vector<int>  lengths(columns);
+    std::string       line;
+    size_t            rows = 0;
+
+    while (results.next()) {
+        for (int n = 0; n < columns; ++n) {
+            int         length = 0;
+            const char* value = results.getString(n + 1, &length);
+            lengths[n] = value ? std::min(length, BOUND_SIZE - 1) : -1;
+            if (value) {
+                memcpy(&bound[n * BOUND_SIZE], value, lengths[n]);
+            }
+        }
+
+        line.clear();
+        for (int n = 0; n < columns; ++n) {
+            if (n > 0) {
+                line += ',';
+            }
+            if (lengths[n] >= 0) {
+                line.append(&bound[n * BOUND_SIZE], lengths[n]);
+            }
+        }
+        line += '\n';
+        if (write(fd, line.data(), (unsigned)line.size()) < 0) {
+            perror("write");
+            exit(1);
+        }
+        ++rows;
+    }
+
+    return rows;
+}
+
+int main(int argc, char** argv)
+{
+    size_t      count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    const char* path = argc > 2 ? argv[2] : NULL_DEVICE;
+    int         fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror(path);
+        return 1;
+    }
+
+    std::vector<StagedKind> kinds = {
+        StagedKind::Integer, StagedKind::Integer, StagedKind::Real, StagedKind::String, StagedKind::String,
+    };
+    std::vector<StagedRow> pool;
+    for (int n = 0; n < POOL_ROWS; ++n) {
+        pool.push_back({ integer(n), integer((int64_t)n * 7919 - 1000000), real(n / 7.0), text("customer " + std::to_string(n)),
+                         n % 10 ? text("1234.56") : null() });
+    }
+    RepeatingResultSet results(kinds, std::move(pool), count);
+    int                columns = (int)kinds.size();
+
+    std::vector<ResultExport::CsvColumn> csvColumns(columns);
+    csvColumns[0].kind = csvColumns[1].kind = csvColumns[2].kind = ResultExport::CsvKind::Typed;
+    csvColumns[0].text = csvColumns[1].text = TextFormat::TextKind::Integer;
+    csvColumns[2].text = TextFormat::TextKind::Double;
+
+    std::vector<ArrowExport::ArrowColumn> arrowColumns(columns);
+    arrowColumns[0].kind = arrowColumns[1].kind = ArrowExport::ArrowKind::Int64;
+    arrowColumns[2].kind = ArrowExport::ArrowKind::Double;
+    arrowColumns[4].kind = ArrowExport::ArrowKind::Decimal;
+    arrowColumns[4].precision = 10;
+    arrowColumns[4].scale = 2;
+
+    NuoODBCExportOptions options;
+    memset(&options, 0, sizeof(options));
+
+    auto   start = std::chrono::steady_clock::now();
+    size_t fetched = fetchByCell(results, columns, fd);
+    report("SQLFetch per cell", fetched, seconds(start));
+
+    for (int format : { NUOODBC_EXPORT_CSV, NUOODBC_EXPORT_ARROW_IPC }) {
+        OutputFile output(fd);
+        size_t     rows = 0;
+        bool       written;
+
+        results.rewind();
+        options.format = format;
+        start = std::chrono::steady_clock::now();
+        if (format == NUOODBC_EXPORT_CSV) {
+            written = ResultExport::writeCsv(&results, csvColumns, nullptr, options, SIZE_MAX, output, &rows);
+        } else {
+            written = ResultExport::writeArrowIpc(&results, arrowColumns, nullptr, options, SIZE_MAX, output, &rows);
+        }
+        if (!written) {
+            fprintf(stderr, "%s: %s\n", path, strerror(output.getError()));
+            return 1;
+        }
+        report(format == NUOODBC_EXPORT_CSV ? "NuoODBCExport CSV" : "NuoODBCExport Arrow IPC", rows, seconds(start));
+    }
+
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "StagedResultSet.h"
+
+#include "NuoRemote/ResultSetMetaData.h"
+
+// The metadata of a FakeResultSet: columns C1, C2... of the SQL type each
+// kind is staged from.
+class FakeMetaData : public NuoDB::ResultSetMetaData
+{
+public:
+    explicit FakeMetaData(const std::vector<StagedKind>& columnKinds)
+        : kinds(columnKinds)
+    {
+        for (size_t n = 1; n <= kinds.size(); ++n) {
+            names.push_back("C" + std::to_string(n));
+        }
+    }
+
+    virtual int         getColumnCount() { return (int)kinds.size(); }
+    virtual const char* getColumnName(int column) { return names[column - 1].c_str(); }
+    virtual const char* getColumnLabel(int column) { return names[column - 1].c_str(); }
+    virtual const char* getSchemaName(int) { return "USER"; }
+    virtual const char* getTableName(int) { return "FAKE"; }
+    virtual const char* getCatalogName(int) { return ""; }
+
+    virtual const char* getColumnTypeName(int column)
+    {
+        switch (kinds[column - 1]) {
+            case StagedKind::Integer:       return "BIGINT";
+            case StagedKind::Real:          return "DOUBLE";
+            case StagedKind::String:        return "VARCHAR";
+            case StagedKind::Date:          return "DATE";
+            case StagedKind::Time:          return "TIME";
+            case StagedKind::Timestamp:     return "TIMESTAMP";
+            case StagedKind::TimestampNoTZ: return "TIMESTAMP WITHOUT TIME ZONE";
+            case StagedKind::Blob:          return "BLOB";
+            case StagedKind::Clob:          return "CLOB";
+            default:                        return "VARBINARY";
+        }
+    }
+
+    virtual int getColumnType(int column)
+    {
+        switch (kinds[column - 1]) {
+            case StagedKind::Integer:       return NuoDB::NUOSQL_BIGINT;
+            case StagedKind::Real:          return NuoDB::NUOSQL_DOUBLE;
+            case StagedKind::String:        return NuoDB::NUOSQL_VARCHAR;
+            case StagedKind::Date:          return NuoDB::NUOSQL_DATE;
+            case StagedKind::Time:          return NuoDB::NUOSQL_TIME;
+            case StagedKind::Timestamp:
+            case StagedKind::TimestampNoTZ: return NuoDB::NUOSQL_TIMESTAMP;
+            case StagedKind::Blob:          return NuoDB::NUOSQL_BLOB;
+            case StagedKind::Clob:          return NuoDB::NUOSQL_CLOB;
+            default:                        return NuoDB::NUOSQL_VARBINARY;
+        }
+    }
+
+    virtual int  getPrecision(int) { return 100; }
+    virtual int  getScale(int) { return 0; }
+    virtual int  getColumnDisplaySize(int) { return 100; }
+    virtual int  getCurrentColumnMaxLength(int) { return 100; }
+    virtual bool isNullable(int) { return true; }
+    virtual bool isSigned(int) { return true; }
+    virtual bool isWritable(int) { return false; }
+    virtual bool isAutoIncrement(int) { return false; }
+    virtual bool isSearchable(int) { return true; }
+    virtual bool isCurrency(int) { return false; }
+    virtual bool isCaseSensitive(int) { return true; }
+
+private:
+    std::vector<StagedKind>  kinds;
+    std::vector<std::string> names;
+};
+
+// A result set over rows made up here, rather than read from a server.
+class FakeResultSet : public StagedResultSet
+{
+public:
+    FakeResultSet(const std::vector<StagedKind>& kinds, std::vector<StagedRow>&& values)
+        : StagedResultSet(nullptr, nullptr, kinds),
+          rows(std::move(values)),
+          fakeMetaData(kinds)
+    {
+        metaData = &fakeMetaData;
+    }
+
+    virtual bool next()
+    {
+        if (current == rows.size()) {
+            setRow(nullptr);
+            return false;
+        }
+        setRow(&rows[current++]);
+        return true;
+    }
+
+    // Read the rows again from the first.
+    void rewind() { current = 0; }
+
+private:
+    std::vector<StagedRow> rows;
+    size_t                 current = 0;
+    FakeMetaData           fakeMetaData;
+};
+
+inline StagedValue integer(int64_t value)
+{
+    StagedValue staged;
+    staged.integer = value;
+    return staged;
+}
+
+inline StagedValue real(double value)
+{
+    StagedValue staged;
+    staged.real = value;
+    return staged;
+}
+
+// The value of a String or a Bytes column.
+inline StagedValue text(std::string value)
+{
+    StagedValue staged;
+    staged.string = std::move(value);
+    return staged;
+}
+
+// The value of a Date, Time, Timestamp or TimestampNoTZ column, which is
+// read as the driver's own object.
+inline StagedValue dateTime(int64_t seconds, int32_t nanos = 0)
+{
+    StagedValue staged;
+    staged.integer = seconds;
+    staged.nanos = nanos;
+    return staged;
+}
+
+inline StagedValue null()
+{
+    StagedValue staged;
+    staged.null = true;
+    return staged;
+}
@@ -0,0 +1,82 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FakeResultSet.h"
+#include "OdbcConnection.h"
+#include "OdbcEnv.h"
+#include "OdbcStatement.h"
+
+// A statement of a connection that's never connected, its cursor over a
+// FakeResultSet, so that the fetch code can be driven without a server.
+class FakeStatement : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        SQLHANDLE handle;
+        env.reset(new OdbcEnv);
+        ASSERT_EQ(SQL_SUCCESS, env->allocHandle(SQL_HANDLE_DBC, &handle));
+        connection = (OdbcConnection*)handle;
+        ASSERT_EQ(SQL_SUCCESS, connection->allocHandle(SQL_HANDLE_STMT, &handle));
+        statement = (OdbcStatement*)handle;
+    }
+
+    // The connection takes its statements with it.
+    void TearDown() override
+    {
+        delete connection;
+    }
+
+    // Make a result set over rows the statement's cursor, as an execute
+    // would.  The one before is kept until the statement has let it go.
+    void setResults(const std::vector<StagedKind>& kinds, std::vector<StagedRow>&& rows)
+    {
+        std::unique_ptr<FakeResultSet> next(new FakeResultSet(kinds, std::move(rows)));
+        statement->setResultSet(next.get());
+        results = std::move(next);
+    }
+
+    // The SQLSTATE of diagnostic record number, "" if there's none.
+    std::string getState(int record = 1)
+    {
+        SQLCHAR     state[6];
+        SQLINTEGER  native;
+        SQLSMALLINT length;
+        if (statement->sqlGetDiagRec(SQL_HANDLE_STMT, record, state, &native, nullptr, 0, &length) == SQL_NO_DATA_FOUND) {
+            return "";
+        }
+        return (char*)state;
+    }
+
+    // The row and column diagnostic record number was posted at.
+    SQLLEN getDiagRow(int record)
+    {
+        SQLLEN row = 0;
+        statement->sqlGetDiagField(record, SQL_DIAG_ROW_NUMBER, &row, 0, nullptr);
+        return row;
+    }
+
+    SQLINTEGER getDiagColumn(int record)
+    {
+        SQLINTEGER column = 0;
+        statement->sqlGetDiagField(record, SQL_DIAG_COLUMN_NUMBER, &column, 0, nullptr);
+        return column;
+    }
+
+    std::unique_ptr<OdbcEnv>       env;
+    OdbcConnection*                connection = nullptr;
+    OdbcStatement*                 statement = nullptr;
+    std::unique_ptr<FakeResultSet> results;
+};
@@ -0,0 +1,279 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "FakeStatement.h"
+
+// The fetch plan a statement compiles for its bound columns, over a fake
+// result set.
+class FetchPlanTest : public FakeStatement
+{
+protected:
+    // Row n (1 based) holds n and its name.
+    static std::vector<StagedRow> makeRows(int count)
+    {
+        std::vector<StagedRow> rows;
+        for (int n = 1; n <= count; ++n) {
+            rows.push_back({ integer(n), text("row " + std::to_string(n)) });
+        }
+        return rows;
+    }
+
+    const std::vector<StagedKind> kinds = { StagedKind::Integer, StagedKind::String };
+};
+
+TEST_F(FetchPlanTest, Rebind)
+{
+    setResults(kinds, makeRows(4));
+
+    SQLINTEGER number = 0;
+    SQLLEN     indicator = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, &number, 0, &indicator));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(1, number);
+    EXPECT_EQ((SQLLEN)sizeof(SQLINTEGER), indicator);
+
+    // the same column as text, into another buffer
+    char text[16];
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_CHAR, text, sizeof(text), &indicator));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("2", text);
+    EXPECT_EQ(1, indicator);
+    EXPECT_EQ(1, number);
+
+    // another column as well
+    char name[16];
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(2, SQL_C_CHAR, name, sizeof(name), nullptr));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("3", text);
+    EXPECT_STREQ("row 3", name);
+
+    // and unbound again
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_CHAR, nullptr, 0, nullptr));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("3", text);
+    EXPECT_STREQ("row 4", name);
+}
+
+// Bound addresses stay those of the first row; the bind type alone decides
+// where the others go.
+TEST_F(FetchPlanTest, BindType)
+{
+    setResults(kinds, makeRows(4));
+
+    SQLINTEGER numbers[4] = { 0, 0, 0, 0 };
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)2, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, numbers, 0, nullptr));
+
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(1, numbers[0]);
+    EXPECT_EQ(2, numbers[1]);
+    EXPECT_EQ(0, numbers[2]);
+
+    // rows of two numbers each
+    memset(numbers, 0, sizeof(numbers));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)(2 * sizeof(SQLINTEGER)), 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(3, numbers[0]);
+    EXPECT_EQ(0, numbers[1]);
+    EXPECT_EQ(4, numbers[2]);
+    EXPECT_EQ(0, numbers[3]);
+}
+
+// A column read as text is formatted by the driver when it isn't a string,
+// so the plan depends on the result set's types, not only the bindings.
+TEST_F(FetchPlanTest, NewResultSet)
+{
+    setResults({ StagedKind::Integer }, { { integer(42) } });
+
+    char   buffer[16];
+    SQLLEN indicator = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("42", buffer);
+
+    setResults({ StagedKind::String }, { { text("forty two") } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("forty two", buffer);
+    EXPECT_EQ(9, indicator);
+
+    setResults({ StagedKind::Real }, { { real(4.5) } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_STREQ("4.5", buffer);
+}
+
+// A cell that fails, or is truncated, is reported at its row and column,
+// and the other cells of the rowset are still converted.
+TEST_F(FetchPlanTest, Diagnostics)
+{
+    // a timestamp can't be made from a number, but a NULL is still a NULL
+    setResults(kinds, { { null(), text("ab") }, { integer(5), text("abcdef") }, { null(), text("abcdefg") } });
+
+    struct Row
+    {
+        SQL_TIMESTAMP_STRUCT timestamp;
+        SQLLEN               timestampIndicator;
+        char                 name[4];
+        SQLLEN               nameIndicator;
+    } rows[3];
+    memset(rows, 0, sizeof(rows));
+
+    SQLUSMALLINT status[3];
+    SQLULEN      fetched = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)3, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)sizeof(Row), 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_STATUS_PTR, status, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_TIMESTAMP, &rows[0].timestamp, 0, &rows[0].timestampIndicator));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(2, SQL_C_CHAR, rows[0].name, sizeof(rows[0].name), &rows[0].nameIndicator));
+
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)3, fetched);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[0]);
+    EXPECT_EQ(SQL_ROW_ERROR, status[1]);
+    EXPECT_EQ(SQL_ROW_SUCCESS_WITH_INFO, status[2]);
+
+    EXPECT_EQ(SQL_NULL_DATA, rows[0].timestampIndicator);
+    EXPECT_STREQ("ab", rows[0].name);
+    EXPECT_STREQ("abc", rows[1].name);
+    EXPECT_EQ(SQL_NULL_DATA, rows[2].timestampIndicator);
+    EXPECT_STREQ("abc", rows[2].name);
+
+    EXPECT_EQ("07006", getState(1));
+    EXPECT_EQ(2, getDiagRow(1));
+    EXPECT_EQ(1, getDiagColumn(1));
+    EXPECT_EQ("01004", getState(2));
+    EXPECT_EQ(2, getDiagRow(2));
+    EXPECT_EQ(2, getDiagColumn(2));
+    EXPECT_EQ("01004", getState(3));
+    EXPECT_EQ(3, getDiagRow(3));
+    EXPECT_EQ(2, getDiagColumn(3));
+    EXPECT_EQ("", getState(4));
+
+    // a rowset whose every row fails is an error, with only its own
+    // diagnostics; the rows it didn't reach are marked as such
+    setResults(kinds, { { integer(1), text("a") }, { integer(2), text("b") } });
+    ASSERT_EQ(SQL_ERROR, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)2, fetched);
+    EXPECT_EQ(SQL_ROW_ERROR, status[0]);
+    EXPECT_EQ(SQL_ROW_ERROR, status[1]);
+    EXPECT_EQ(SQL_NO_DATA, status[2]);
+    EXPECT_STREQ("b", rows[1].name);
+    EXPECT_EQ(1, getDiagRow(1));
+    EXPECT_EQ(2, getDiagRow(2));
+    EXPECT_EQ("", getState(3));
+}
+
+// Column-wise rowsets of more than one row go through the block path,
+// where fixed-width columns are staged and stored a column at a time.
+TEST_F(FetchPlanTest, ShortRowset)
+{
+    setResults({ StagedKind::Integer, StagedKind::Real, StagedKind::String },
+               { { integer(1), real(0.5), text("one") },
+                 { null(), real(1.5), text("two") },
+                 { integer(3), null(), null() },
+                 { integer(4), real(3.5), text("four") },
+                 { null(), null(), text("five") } });
+
+    SQLINTEGER   numbers[3];
+    SQLLEN       numberIndicators[3];
+    double       reals[3];
+    SQLLEN       realIndicators[3];
+    char         names[3][8];
+    SQLLEN       nameIndicators[3];
+    SQLUSMALLINT status[3];
+    SQLULEN      fetched = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)3, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_STATUS_PTR, status, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, numbers, 0, numberIndicators));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(2, SQL_C_DOUBLE, reals, 0, realIndicators));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(3, SQL_C_CHAR, names, sizeof(names[0]), nameIndicators));
+
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)3, fetched);
+    for (int row = 0; row < 3; ++row) {
+        EXPECT_EQ(SQL_ROW_SUCCESS, status[row]) << row;
+    }
+    EXPECT_EQ(1, numbers[0]);
+    EXPECT_EQ((SQLLEN)sizeof(SQLINTEGER), numberIndicators[0]);
+    EXPECT_EQ(SQL_NULL_DATA, numberIndicators[1]);
+    EXPECT_EQ(3, numbers[2]);
+    EXPECT_EQ(1.5, reals[1]);
+    EXPECT_EQ((SQLLEN)sizeof(double), realIndicators[1]);
+    EXPECT_EQ(SQL_NULL_DATA, realIndicators[2]);
+    EXPECT_STREQ("two", names[1]);
+    EXPECT_EQ(3, nameIndicators[1]);
+    EXPECT_EQ(SQL_NULL_DATA, nameIndicators[2]);
+
+    // the last rowset is short; the rows past the end are marked
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)2, fetched);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[0]);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[1]);
+    EXPECT_EQ(SQL_NO_DATA, status[2]);
+    EXPECT_EQ(4, numbers[0]);
+    EXPECT_EQ(3.5, reals[0]);
+    EXPECT_STREQ("four", names[0]);
+    EXPECT_EQ(SQL_NULL_DATA, numberIndicators[1]);
+    EXPECT_EQ(SQL_NULL_DATA, realIndicators[1]);
+    EXPECT_STREQ("five", names[1]);
+
+    ASSERT_EQ(SQL_NO_DATA, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)0, fetched);
+    EXPECT_EQ(SQL_NO_DATA, status[0]);
+}
+
+// A row of a block that fails is marked, and its other columns, and the
+// other rows, are still stored.
+TEST_F(FetchPlanTest, BlockRowError)
+{
+    setResults({ StagedKind::Integer, StagedKind::Integer, StagedKind::String },
+               { { integer(1), null(), text("one") },
+                 { integer(2), integer(5), text("two") },
+                 { integer(3), null(), text("three") } });
+
+    SQLINTEGER           numbers[3];
+    SQLLEN               numberIndicators[3];
+    SQL_TIMESTAMP_STRUCT timestamps[3];
+    SQLLEN               timestampIndicators[3];
+    char                 names[3][8];
+    SQLUSMALLINT         status[3];
+    SQLULEN              fetched = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)3, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_STATUS_PTR, status, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, numbers, 0, numberIndicators));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(2, SQL_C_TIMESTAMP, timestamps, 0, timestampIndicators));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(3, SQL_C_CHAR, names, sizeof(names[0]), nullptr));
+
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlFetch());
+    EXPECT_EQ((SQLULEN)3, fetched);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[0]);
+    EXPECT_EQ(SQL_ROW_ERROR, status[1]);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[2]);
+
+    for (int row = 0; row < 3; ++row) {
+        EXPECT_EQ(row + 1, numbers[row]) << row;
+        EXPECT_EQ((SQLLEN)sizeof(SQLINTEGER), numberIndicators[row]) << row;
+    }
+    EXPECT_EQ(SQL_NULL_DATA, timestampIndicators[0]);
+    EXPECT_EQ(SQL_NULL_DATA, timestampIndicators[2]);
+    EXPECT_STREQ("one", names[0]);
+    EXPECT_STREQ("two", names[1]);
+    EXPECT_STREQ("three", names[2]);
+
+    EXPECT_EQ("07006", getState(1));
+    EXPECT_EQ(2, getDiagRow(1));
+    EXPECT_EQ(2, getDiagColumn(1));
+    EXPECT_EQ("", getState(2));
+}
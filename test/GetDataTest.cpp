@@ -0,0 +1,210 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "FakeStatement.h"
+
+// SQLGetData over a fake result set: values read in parts, and the columns
+// and rows it may read (SQL_GETDATA_EXTENSIONS).
+class GetDataTest : public FakeStatement
+{
+protected:
+    // Read a column in parts of at most 'size' bytes of buffer, checking
+    // each return and that the indicator counts the bytes still to come;
+    // the parts, without terminators, put together.
+    std::string readParts(SQLUSMALLINT column, SQLSMALLINT cType, SQLLEN size, size_t terminator, size_t unit = 1)
+    {
+        std::string       value;
+        std::vector<char> buffer(size);
+        SQLLEN            remaining = -1;
+
+        for (;;) {
+            SQLLEN  indicator = 0;
+            RETCODE ret = statement->sqlGetData(column, cType, buffer.data(), size, &indicator);
+            if (ret == SQL_NO_DATA) {
+                break;
+            }
+
+            if (remaining >= 0) {
+                EXPECT_EQ(remaining, indicator) << value.size();
+            }
+            SQLLEN part = indicator;
+            if (indicator + (SQLLEN)terminator > size) {
+                EXPECT_EQ(SQL_SUCCESS_WITH_INFO, ret) << value.size();
+                EXPECT_EQ("01004", getState());
+                part = (size - (SQLLEN)terminator) / (SQLLEN)unit * (SQLLEN)unit;
+            } else {
+                EXPECT_EQ(SQL_SUCCESS, ret) << value.size();
+            }
+            value.append(buffer.data(), part);
+            remaining = indicator - part;
+
+            if (ret == SQL_SUCCESS) {
+                EXPECT_EQ(0, remaining);
+                EXPECT_EQ(SQL_NO_DATA, statement->sqlGetData(column, cType, buffer.data(), size, &indicator));
+                break;
+            }
+        }
+
+        return value;
+    }
+};
+
+TEST_F(GetDataTest, CharParts)
+{
+    setResults({ StagedKind::String }, { { text("abcdefghij") } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    char   buffer[4];
+    SQLLEN indicator = 0;
+    EXPECT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_EQ("01004", getState());
+    EXPECT_EQ(10, indicator);
+    EXPECT_STREQ("abc", buffer);
+
+    EXPECT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_EQ(7, indicator);
+    EXPECT_STREQ("def", buffer);
+
+    EXPECT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_EQ(4, indicator);
+    EXPECT_STREQ("ghi", buffer);
+
+    EXPECT_EQ(SQL_SUCCESS, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_EQ("", getState());
+    EXPECT_EQ(1, indicator);
+    EXPECT_STREQ("j", buffer);
+
+    EXPECT_EQ(SQL_NO_DATA, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+}
+
+// Other types are read in parts of the text the driver formats them as.
+TEST_F(GetDataTest, FormattedParts)
+{
+    setResults({ StagedKind::Integer, StagedKind::Real }, { { integer(1234567890123), real(0.25) } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    EXPECT_EQ("1234567890123", readParts(1, SQL_C_CHAR, 5, 1));
+    EXPECT_EQ("0.25", readParts(2, SQL_C_CHAR, 2, 1));
+}
+
+// Parts end on whole characters; the indicator is in bytes.
+TEST_F(GetDataTest, WCharParts)
+{
+    setResults({ StagedKind::String }, { { text("gr\xc3\xbc\xc3\x9f dich, w\xc3\xb6rld") } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    std::string            value = readParts(1, SQL_C_WCHAR, 4 * sizeof(SQLWCHAR), sizeof(SQLWCHAR), sizeof(SQLWCHAR));
+    std::vector<SQLWCHAR>  expected = { 'g', 'r', 0xfc, 0xdf, ' ', 'd', 'i', 'c', 'h', ',', ' ', 'w', 0xf6, 'r', 'l', 'd' };
+    ASSERT_EQ(expected.size() * sizeof(SQLWCHAR), value.size());
+    EXPECT_EQ(0, memcmp(expected.data(), value.data(), value.size()));
+}
+
+// No terminator, and the last part may fill the buffer exactly.
+TEST_F(GetDataTest, BinaryParts)
+{
+    const std::string bytes("\x00\x01\x02\xff\x00\x7f\x80\x10\x20\x30\x40\x50", 12);
+    setResults({ StagedKind::Bytes }, { { text(bytes) } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    EXPECT_EQ(bytes, readParts(1, SQL_C_BINARY, 5, 0));
+
+    setResults({ StagedKind::Bytes }, { { text(bytes) } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    EXPECT_EQ(bytes, readParts(1, SQL_C_BINARY, 4, 0));
+}
+
+// A NULL has no parts.
+TEST_F(GetDataTest, Null)
+{
+    setResults({ StagedKind::String }, { { null() } });
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+
+    char   buffer[4];
+    SQLLEN indicator = 0;
+    EXPECT_EQ(SQL_SUCCESS, statement->sqlGetData(1, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_EQ(SQL_NULL_DATA, indicator);
+}
+
+// SQL_GD_ANY_COLUMN and SQL_GD_ANY_ORDER: columns in any order, before or
+// after bound ones; a column read again starts over once another has been
+// read.  SQL_GD_BOUND: a bound column can be read as well.
+TEST_F(GetDataTest, AnyColumnAnyOrder)
+{
+    setResults({ StagedKind::Integer, StagedKind::String, StagedKind::String }, { { integer(7), text("seven"), text("sieben") } });
+
+    SQLINTEGER number = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(2, SQL_C_CHAR, nullptr, 0, nullptr));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, &number, 0, nullptr));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(7, number);
+
+    char   buffer[4];
+    SQLLEN indicator = 0;
+    EXPECT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlGetData(3, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_STREQ("sie", buffer);
+
+    EXPECT_EQ("seven", readParts(2, SQL_C_CHAR, 3, 1));
+
+    SQLINTEGER again = 0;
+    EXPECT_EQ(SQL_SUCCESS, statement->sqlGetData(1, SQL_C_LONG, &again, 0, &indicator));
+    EXPECT_EQ(7, again);
+
+    EXPECT_EQ("sieben", readParts(3, SQL_C_CHAR, 4, 1));
+}
+
+// SQL_GD_BLOCK: with a block cursor the unbound columns are read on any
+// row of the rowset chosen by SQLSetPos, and a bound column only on the
+// cursor's own row, the last of a full rowset.
+TEST_F(GetDataTest, BlockCursor)
+{
+    setResults({ StagedKind::Integer, StagedKind::String },
+               { { integer(1), text("one") }, { integer(2), text("two") }, { integer(3), text("three") },
+                 { integer(4), text("four") } });
+
+    SQLINTEGER numbers[3];
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetStmtAttr(SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)3, 0));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlBindCol(1, SQL_C_LONG, numbers, 0, nullptr));
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(3, numbers[2]);
+
+    EXPECT_EQ("one", readParts(2, SQL_C_CHAR, 3, 1));
+
+    // a part of the second row, then the third from its start
+    char   buffer[3];
+    SQLLEN indicator = 0;
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetPos(2, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+    EXPECT_EQ(SQL_SUCCESS_WITH_INFO, statement->sqlGetData(2, SQL_C_CHAR, buffer, sizeof(buffer), &indicator));
+    EXPECT_STREQ("tw", buffer);
+
+    SQLINTEGER number = 0;
+    EXPECT_EQ(SQL_ERROR, statement->sqlGetData(1, SQL_C_LONG, &number, 0, &indicator));
+    EXPECT_EQ("HY109", getState());
+
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetPos(3, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+    EXPECT_EQ("three", readParts(2, SQL_C_CHAR, 4, 1));
+    EXPECT_EQ(SQL_SUCCESS, statement->sqlGetData(1, SQL_C_LONG, &number, 0, &indicator));
+    EXPECT_EQ(3, number);
+
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlSetPos(1, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+    EXPECT_EQ("one", readParts(2, SQL_C_CHAR, 8, 1));
+    EXPECT_EQ(SQL_ERROR, statement->sqlSetPos(4, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+    EXPECT_EQ("HY107", getState());
+
+    // a short rowset has no cursor row to read a bound column on
+    ASSERT_EQ(SQL_SUCCESS, statement->sqlFetch());
+    EXPECT_EQ(4, numbers[0]);
+    EXPECT_EQ("four", readParts(2, SQL_C_CHAR, 3, 1));
+    EXPECT_EQ(SQL_ERROR, statement->sqlGetData(1, SQL_C_LONG, &number, 0, &indicator));
+    EXPECT_EQ("HY109", getState());
+}
@@ -0,0 +1,92 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+// HexCodec with each kernel this CPU can run: whole values encoded, as a
+// bound SQL_C_CHAR column of a BINARY column is; values encoded a piece at
+// a time into a buffer with an odd number of digits' room, as SQLGetData
+// does; and values decoded, as a binary parameter sent as SQL_C_CHAR is.
+// Each is run over values of several sizes, totalling the bytes given.
+//
+//     NuoODBCHexBenchmark [bytes]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "HexCodec.h"
+
+#define PIECE_DIGITS 4095   // SQLGetData into a 4K buffer, less the terminator
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* kernel, const char* name, size_t valueSize, size_t bytes, double elapsed)
+{
+    printf("%-7s %-8s %8zu byte values %10.1f MB/s\n", kernel, name, valueSize, bytes / elapsed / 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    size_t total = argc > 1 ? strtoul(argv[1], nullptr, 10) : 256 * 1024 * 1024;
+
+    const char* picked = HexCodec::getKernelName();
+    printf("picked for this CPU: %s\n", picked);
+
+    for (size_t valueSize : { 16, 256, 4096, 1024 * 1024 }) {
+        size_t               values = std::max<size_t>(1, total / valueSize);
+        std::vector<uint8_t> bytes(valueSize);
+        for (size_t n = 0; n < valueSize; ++n) {
+            bytes[n] = (uint8_t)(n * 37 + 11);
+        }
+        std::string          text(2 * valueSize, '0');
+        std::vector<uint8_t> decoded(valueSize);
+
+        for (const char* kernel : { "scalar", "sse2", "avx2" }) {
+            if (!HexCodec::useKernel(kernel)) {
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < values; ++n) {
+                HexCodec::encode(bytes.data(), valueSize, &text[0]);
+            }
+            report(kernel, "encode", valueSize, values * valueSize, seconds(start));
+
+            std::string piece(PIECE_DIGITS, '0');
+            start = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < values; ++n) {
+                for (size_t first = 0; first < text.size(); first += PIECE_DIGITS) {
+                    HexCodec::encodeDigits(bytes.data(), first, std::min<size_t>(PIECE_DIGITS, text.size() - first), &piece[0]);
+                }
+            }
+            report(kernel, "pieces", valueSize, values * valueSize, seconds(start));
+
+            start = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < values; ++n) {
+                if (!HexCodec::decode(text.data(), text.size(), decoded.data())) {
+                    fprintf(stderr, "decode failed\n");
+                    return 1;
+                }
+            }
+            report(kernel, "decode", valueSize, values * valueSize, seconds(start));
+
+            if (decoded != bytes) {
+                fprintf(stderr, "%s: decoded value differs\n", kernel);
+                return 1;
+            }
+        }
+    }
+
+    HexCodec::useKernel(picked);
+    return 0;
+}
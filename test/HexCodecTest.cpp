@@ -0,0 +1,113 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "HexCodec.h"
+
+// Each kernel this CPU can run, with the one picked put back afterwards.
+class HexCodecTest : public ::testing::TestWithParam<const char*>
+{
+protected:
+    void SetUp() override
+    {
+        picked = HexCodec::getKernelName();
+        if (!HexCodec::useKernel(GetParam())) {
+            GTEST_SKIP() << GetParam() << " isn't supported here";
+        }
+    }
+
+    void TearDown() override { HexCodec::useKernel(picked); }
+
+    // length bytes running through every value, the lengths tested going
+    // either side of each kernel's block size
+    static std::vector<uint8_t> makeBytes(size_t length)
+    {
+        std::vector<uint8_t> bytes(length);
+        for (size_t n = 0; n < length; ++n) {
+            bytes[n] = (uint8_t)(n * 37 + 11);
+        }
+        return bytes;
+    }
+
+    static std::string reference(const std::vector<uint8_t>& bytes)
+    {
+        static const char digits[] = "0123456789ABCDEF";
+        std::string       text;
+        for (uint8_t byte : bytes) {
+            text += digits[byte >> 4];
+            text += digits[byte & 0xf];
+        }
+        return text;
+    }
+
+    const char* picked = nullptr;
+};
+
+TEST_P(HexCodecTest, Encode)
+{
+    for (size_t length = 0; length <= 200; ++length) {
+        std::vector<uint8_t> bytes = makeBytes(length);
+        std::string          text(2 * length, '?');
+        HexCodec::encode(bytes.data(), length, &text[0]);
+        ASSERT_EQ(reference(bytes), text) << length;
+    }
+}
+
+TEST_P(HexCodecTest, EncodeDigits)
+{
+    std::vector<uint8_t> bytes = makeBytes(80);
+    std::string          whole = reference(bytes);
+
+    // any piece, including ones that start or end half way through a byte
+    for (size_t first = 0; first <= whole.size(); first += 3) {
+        for (size_t count = 0; first + count <= whole.size(); ++count) {
+            std::string text(count, '?');
+            HexCodec::encodeDigits(bytes.data(), first, count, &text[0]);
+            ASSERT_EQ(whole.substr(first, count), text) << first << " " << count;
+        }
+    }
+}
+
+TEST_P(HexCodecTest, Decode)
+{
+    for (size_t length = 0; length <= 200; ++length) {
+        std::vector<uint8_t> bytes = makeBytes(length);
+        std::string          text = reference(bytes);
+
+        // either case, both mixed in one value
+        for (size_t n = 0; n < text.size(); n += 3) {
+            text[n] = (char)tolower(text[n]);
+        }
+
+        std::vector<uint8_t> decoded(length);
+        ASSERT_TRUE(HexCodec::decode(text.data(), text.size(), decoded.data())) << length;
+        ASSERT_EQ(bytes, decoded) << length;
+    }
+}
+
+TEST_P(HexCodecTest, DecodeErrors)
+{
+    std::string          text = reference(makeBytes(100));
+    std::vector<uint8_t> decoded(100);
+
+    EXPECT_FALSE(HexCodec::decode(text.data(), text.size() - 1, decoded.data()));
+
+    // something other than a digit anywhere, in a block or the tail
+    for (char bad : { 'g', 'G', '/', ':', '@', '`', ' ', '\0', '\x80', '\xC6' }) {
+        for (size_t n = 0; n < text.size(); n += 7) {
+            std::string wrong = text;
+            wrong[n] = bad;
+            ASSERT_FALSE(HexCodec::decode(wrong.data(), wrong.size(), decoded.data())) << n << " " << (int)bad;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, HexCodecTest, ::testing::Values("scalar", "sse2", "avx2"));
@@ -0,0 +1,114 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "FakeResultSet.h"
+#include "LobFile.h"
+#include "OdbcTypeMapper.h"
+
+using namespace NuoDB;
+
+namespace fs = std::filesystem;
+
+static std::string readFile(const fs::path& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const fs::path& path, const std::string& contents)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+class LobFileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        directory = fs::temp_directory_path() / ("LobFileTest." + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+        fs::create_directories(directory);
+        path = directory / "value";
+
+        std::vector<StagedRow> rows = {
+            { text("some text"), text(std::string("\x00\x01\xfe\xff", 4)) },
+            { null(), null() },
+        };
+        results.reset(new FakeResultSet({ StagedKind::String, StagedKind::Bytes }, std::move(rows)));
+    }
+
+    void TearDown() override { fs::remove_all(directory); }
+
+    fs::path                       directory;
+    fs::path                       path;
+    std::unique_ptr<FakeResultSet> results;
+};
+
+TEST_F(LobFileTest, WriteColumn)
+{
+    SQLLEN length = 0;
+    ASSERT_TRUE(results->next());
+
+    ASSERT_TRUE(LobFile::writeColumn(results.get(), 1, (int)NUOSQL_VARCHAR, 0, path.string().c_str(), &length));
+    EXPECT_EQ(9, length);
+    EXPECT_EQ("some text", readFile(path));
+
+    // replaced, and capped by SQL_ATTR_MAX_LENGTH
+    ASSERT_TRUE(LobFile::writeColumn(results.get(), 2, (int)NUOSQL_VARBINARY, 3, path.string().c_str(), &length));
+    EXPECT_EQ(3, length);
+    EXPECT_EQ(std::string("\x00\x01\xfe", 3), readFile(path));
+
+    // a NULL leaves the file alone
+    ASSERT_TRUE(results->next());
+    ASSERT_TRUE(LobFile::writeColumn(results.get(), 1, (int)NUOSQL_VARCHAR, 0, path.string().c_str(), &length));
+    EXPECT_EQ(SQL_NULL_DATA, length);
+    EXPECT_EQ(std::string("\x00\x01\xfe", 3), readFile(path));
+}
+
+TEST_F(LobFileTest, WriteErrors)
+{
+    SQLLEN length = 0;
+    ASSERT_TRUE(results->next());
+
+    fs::path missing = directory / "missing" / "value";
+    EXPECT_FALSE(LobFile::writeColumn(results.get(), 1, (int)NUOSQL_VARCHAR, 0, missing.string().c_str(), &length));
+    EXPECT_EQ(ENOENT, errno);
+
+    // a path has to end within its buffer
+    char buffer[4] = { 'a', 'b', 'c', 'd' };
+    EXPECT_EQ(nullptr, LobFile::getPath(buffer, sizeof(buffer)));
+    buffer[3] = 0;
+    EXPECT_STREQ("abc", LobFile::getPath(buffer, sizeof(buffer)));
+}
+
+TEST_F(LobFileTest, MappedFile)
+{
+    MappedFile file;
+
+    writeFile(path, std::string(100000, 'x') + "end");
+    ASSERT_TRUE(file.open(path.string().c_str()));
+    ASSERT_EQ((size_t)100003, file.getLength());
+    EXPECT_EQ("end", std::string(file.getData() + 100000, 3));
+
+    writeFile(path, "");
+    ASSERT_TRUE(file.open(path.string().c_str()));
+    EXPECT_EQ((size_t)0, file.getLength());
+    EXPECT_NE(nullptr, file.getData());
+
+    EXPECT_FALSE(file.open((directory / "missing").string().c_str()));
+    EXPECT_EQ(ENOENT, errno);
+    EXPECT_EQ(nullptr, file.getData());
+}
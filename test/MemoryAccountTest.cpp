@@ -0,0 +1,91 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "FakeResultSet.h"
+#include "MemoryAccount.h"
+#include "RowStore.h"
+
+TEST(MemoryAccountTest, Limit)
+{
+    MemoryAccount account;
+
+    EXPECT_TRUE(account.charge(MemoryUse::Parameters, 1000));
+    EXPECT_TRUE(account.charge(MemoryUse::GetData, 500));
+    EXPECT_EQ((size_t)1500, account.getUsed());
+
+    account.setLimit(2000);
+    EXPECT_FALSE(account.charge(MemoryUse::Rowsets, 501));
+    EXPECT_TRUE(account.charge(MemoryUse::Rowsets, 500));
+    EXPECT_FALSE(account.charge(MemoryUse::Rowsets, 1));
+    EXPECT_TRUE(account.charge(MemoryUse::Prefetch, 100, true));
+    EXPECT_EQ((size_t)2100, account.getUsed());
+
+    account.credit(MemoryUse::Parameters, 1000);
+    account.credit(MemoryUse::Prefetch, 100);
+    EXPECT_EQ((size_t)1000, account.getUsed());
+    EXPECT_EQ((size_t)0, account.getUsed(MemoryUse::Parameters));
+    EXPECT_EQ((size_t)2100, account.getPeak());
+    EXPECT_EQ("parameters=0;getdata=500;rowsets=500;prefetch=0;cursors=0;peak=2100", account.describe());
+}
+
+TEST(MemoryAccountTest, Charge)
+{
+    MemoryAccount account;
+    account.setLimit(100);
+    {
+        MemoryCharge charge(&account, MemoryUse::GetData);
+        EXPECT_TRUE(charge.set(60));
+        EXPECT_FALSE(charge.set(101));
+        EXPECT_EQ((size_t)60, charge.get());
+        EXPECT_TRUE(charge.set(100));
+        EXPECT_TRUE(charge.set(40));
+        EXPECT_EQ((size_t)40, account.getUsed(MemoryUse::GetData));
+        charge.force(150);
+        EXPECT_EQ((size_t)150, account.getUsed());
+    }
+    EXPECT_EQ((size_t)0, account.getUsed());
+
+    // without an account nothing is refused
+    MemoryCharge loose;
+    EXPECT_TRUE(loose.set(1000));
+    EXPECT_EQ((size_t)1000, loose.get());
+}
+
+// A store keeps its rows in memory while the account allows, and spills
+// them after that.
+TEST(MemoryAccountTest, RowStore)
+{
+    MemoryAccount account;
+    account.setLimit(ROW_STORE_SEGMENT + ROW_STORE_SEGMENT / 2);
+
+    std::vector<StagedRow> rows;
+    for (int n = 0; n < 30; ++n) {
+        rows.push_back({ text(std::string(100 * 1024, (char)('a' + n % 26))) });
+    }
+    FakeResultSet results({ StagedKind::String }, std::move(rows));
+
+    {
+        RowStore store({ StagedKind::String }, 64 * ROW_STORE_SEGMENT, nullptr, &account);
+        while (results.next()) {
+            store.append(&results);
+        }
+
+        EXPECT_EQ((size_t)ROW_STORE_SEGMENT, store.getMemoryUsed());
+        EXPECT_EQ((size_t)ROW_STORE_SEGMENT, account.getUsed(MemoryUse::Cursors));
+        EXPECT_GT(store.getSpilledBytes(), (size_t)0);
+
+        StagedRow row;
+        store.read(29, row);
+        EXPECT_EQ(std::string(100 * 1024, 'd'), row[0].string);
+    }
+    EXPECT_EQ((size_t)0, account.getUsed());
+}
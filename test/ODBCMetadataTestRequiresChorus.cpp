@@ -1153,8 +1153,10 @@ TEST_F(ODBCMetadataTestRequiresChorus, StmtAttrs)
 
     ASSERT_EQ(SQL_SUCCESS,
         SQLSetStmtAttr(hstmt1, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_FORWARD_ONLY, SQL_IS_UINTEGER));
-    ASSERT_EQ(SQL_SUCCESS_WITH_INFO,
+    ASSERT_EQ(SQL_SUCCESS,
         SQLSetStmtAttr(hstmt1, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_KEYSET_DRIVEN, SQL_IS_UINTEGER));
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO,
+        SQLSetStmtAttr(hstmt1, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_DYNAMIC, SQL_IS_UINTEGER));
 
     ASSERT_EQ(SQL_SUCCESS, SQLFreeStmt(hstmt1, SQL_CLOSE));
 }
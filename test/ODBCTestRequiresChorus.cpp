@@ -6,6 +6,7 @@
  */
 
 #include "ODBCTestBase.h"
+#include "../src/NuoODBCAttributes.h"
 
 #include <vector>
 #include <string>
@@ -2323,3 +2324,899 @@ TEST_F(ODBCTestRequiresChorus, testMaxColumnNumberForBinding)
     ret = SQLBindCol(stmt, 10001, SQL_CHAR, buffer, sizeof(buffer), &LenOrInd );
     ASSERT_EQ(ret, SQL_ERROR);
 }
+
+TEST_F(ODBCTestRequiresChorus, NumericRoundTrip)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a decimal(20,4))");
+
+    // -1234567890123.4567: 12345678901234567 = 0x2BDC545D6B4B87 ten-thousandths
+    SQL_NUMERIC_STRUCT in = {};
+    in.precision = 20;
+    in.scale = 4;
+    in.sign = 0;
+    const unsigned char mantissa[] = { 0x87, 0x4B, 0x6B, 0x5D, 0x54, 0xDC, 0x2B };
+    memcpy(in.val, mantissa, sizeof(mantissa));
+    SQLLEN inLength = sizeof(in);
+
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_NUMERIC, SQL_DECIMAL, 20, 4, &in, 0, &inLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLExecute(stmt);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    freeStmt();
+
+    execDirectAndFetch("select cast(a as string) from t1");
+    bool isNull;
+    ASSERT_STREQ("-1234567890123.4567", getCharData(1, isNull).c_str());
+    freeStmt();
+
+    SQL_NUMERIC_STRUCT out = {};
+    SQLLEN outLength = 0;
+    ret = SQLBindCol(stmt, 1, SQL_C_NUMERIC, &out, sizeof(out), &outLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    execDirect("select a from t1");
+    ret = SQLFetch(stmt);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ((SQLLEN)sizeof(out), outLength);
+    ASSERT_EQ(4, out.scale);
+    ASSERT_EQ(0, out.sign);
+    ASSERT_EQ(0, memcmp(in.val, out.val, sizeof(in.val)));
+    freeStmt();
+
+    // a smaller scale in the ARD drops digits: fractional truncation
+    SQLHDESC ard;
+    ret = SQLGetStmtAttr(stmt, SQL_ATTR_APP_ROW_DESC, &ard, 0, NULL);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLSetDescField(ard, 1, SQL_DESC_PRECISION, (SQLPOINTER)20, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetDescField(ard, 1, SQL_DESC_SCALE, (SQLPOINTER)2, 0));
+    ret = SQLBindCol(stmt, 1, SQL_C_NUMERIC, &out, sizeof(out), &outLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    execDirect("select a from t1");
+    ret = SQLFetch(stmt);
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, ret);
+    std::string sqlState, message;
+    extractError(stmt, SQL_HANDLE_STMT, sqlState, message);
+    ASSERT_STREQ("01S07", sqlState.c_str());
+    ASSERT_EQ(2, out.scale);
+    freeStmt();
+
+    // changed between fetches, and set explicitly to 0: the next row is
+    // converted with the new scale
+    execDirect("insert into t1 values (-1234567890123.4567)");
+    ASSERT_EQ(SQL_SUCCESS, SQLSetDescField(ard, 1, SQL_DESC_SCALE, (SQLPOINTER)2, 0));
+    ret = SQLBindCol(stmt, 1, SQL_C_NUMERIC, &out, sizeof(out), &outLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    execDirect("select a from t1");
+    ret = SQLFetch(stmt);
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, ret);
+    ASSERT_EQ(2, out.scale);
+    ASSERT_EQ(SQL_SUCCESS, SQLSetDescField(ard, 1, SQL_DESC_PRECISION, (SQLPOINTER)0, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetDescField(ard, 1, SQL_DESC_SCALE, (SQLPOINTER)0, 0));
+    ret = SQLFetch(stmt);
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, ret);
+    ASSERT_EQ(0, out.scale);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, MaxLengthCapsBlob)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a blob)");
+
+    const int BLOB_SIZE = 10000;
+    const int MAX_LENGTH = 3000;
+    const int CHUNK_SIZE = 1000;
+    std::vector<char> blob(BLOB_SIZE);
+    for (int i = 0; i < BLOB_SIZE; i++) {
+        blob[i] = (char)(i % 251);
+    }
+    SQLLEN blobLength = BLOB_SIZE;
+
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_BINARY, SQL_LONGVARBINARY, BLOB_SIZE, 0, blob.data(), BLOB_SIZE, &blobLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLExecute(stmt);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    freeStmt();
+
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_MAX_LENGTH, (SQLPOINTER)MAX_LENGTH, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    SQLULEN maxLength = 0;
+    ret = SQLGetStmtAttr(stmt, SQL_ATTR_MAX_LENGTH, &maxLength, 0, NULL);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ((SQLULEN)MAX_LENGTH, maxLength);
+
+    execDirectAndFetch("select a from t1");
+
+    std::vector<char> selected(BLOB_SIZE);
+    SQLLEN indicator = 0;
+    int    offset = 0;
+    while ((ret = SQLGetData(stmt, 1, SQL_C_BINARY, &selected[offset], CHUNK_SIZE, &indicator)) != SQL_NO_DATA) {
+        ASSERT_EQ(offset + CHUNK_SIZE < MAX_LENGTH ? SQL_SUCCESS_WITH_INFO : SQL_SUCCESS, ret);
+        ASSERT_EQ(MAX_LENGTH - offset, indicator);
+        offset += CHUNK_SIZE;
+    }
+    ASSERT_EQ(MAX_LENGTH, offset);
+
+    for (int i = 0; i < MAX_LENGTH; i++) {
+        ASSERT_EQ(blob[i], selected[i]);
+    }
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, ClobAsWideCharInChunks)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a clob)");
+
+    // two, three and four byte sequences, so that chunks split them
+    std::string clob;
+    for (int i = 0; i < 2000; i++) {
+        clob += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    }
+    SQLLEN clobLength = clob.size();
+
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_LONGVARCHAR, clob.size(), 0, (SQLPOINTER)clob.data(), clob.size(), &clobLength);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLExecute(stmt);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    freeStmt();
+
+    execDirectAndFetch("select a from t1");
+
+    // room for 7 units and the terminator
+    const int CHUNK_SIZE = 16;
+    std::u16string selected;
+    char16_t       chunk[CHUNK_SIZE / 2];
+    SQLLEN         indicator = 0;
+    while ((ret = SQLGetData(stmt, 1, SQL_C_WCHAR, chunk, CHUNK_SIZE, &indicator)) != SQL_NO_DATA) {
+        ASSERT_TRUE(ret == SQL_SUCCESS || ret == SQL_SUCCESS_WITH_INFO);
+        if (ret == SQL_SUCCESS_WITH_INFO) {
+            ASSERT_EQ(SQL_NO_TOTAL, indicator);
+            selected.append(chunk, CHUNK_SIZE / 2 - 1);
+        } else {
+            ASSERT_EQ(0, indicator % 2);
+            selected.append(chunk, indicator / 2);
+        }
+    }
+
+    std::u16string expected;
+    for (int i = 0; i < 2000; i++) {
+        expected += u"aé€\U0001F600";
+    }
+    ASSERT_EQ(expected, selected);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, VarbinaryKeys)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a varbinary(16))");
+    execDirect("insert into t1 values (x'00112233445566778899aabbccddeeff')");
+
+    unsigned char expected[16] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+    // bound: the whole value
+    unsigned char key[16] = {};
+    SQLLEN        indicator = 0;
+    RETCODE ret = SQLBindCol(stmt, 1, SQL_C_BINARY, key, sizeof(key), &indicator);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    execDirectAndFetch("select a from t1");
+    ASSERT_EQ(16, indicator);
+    ASSERT_EQ(0, memcmp(expected, key, sizeof(key)));
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_UNBIND);
+
+    // SQLGetData: in pieces, with truncation
+    execDirectAndFetch("select a from t1");
+    unsigned char piece[10];
+    ret = SQLGetData(stmt, 1, SQL_C_BINARY, piece, sizeof(piece), &indicator);
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, ret);
+    ASSERT_EQ(16, indicator);
+    ASSERT_EQ(0, memcmp(expected, piece, 10));
+    ret = SQLGetData(stmt, 1, SQL_C_BINARY, piece, sizeof(piece), &indicator);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(6, indicator);
+    ASSERT_EQ(0, memcmp(expected + 10, piece, 6));
+    ret = SQLGetData(stmt, 1, SQL_C_BINARY, piece, sizeof(piece), &indicator);
+    ASSERT_EQ(SQL_NO_DATA, ret);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, TypedColumnsAsText)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(i bigint, d double, r real, dt date, ts timestamp, n integer)");
+    execDirect("insert into t1 values (-1234567890123, 0.1, 2.5, date('2024-02-09'), timestamp('2024-02-09 03:04:05.12'), null)");
+
+    char   text[6][64];
+    SQLLEN indicator[6];
+    for (int n = 0; n < 6; n++) {
+        RETCODE ret = SQLBindCol(stmt, n + 1, SQL_C_CHAR, text[n], sizeof(text[n]), &indicator[n]);
+        ASSERT_EQ(SQL_SUCCESS, ret);
+    }
+    execDirectAndFetch("select i, d, r, dt, ts, n from t1");
+
+    ASSERT_STREQ("-1234567890123", text[0]);
+    ASSERT_STREQ("0.1", text[1]);
+    ASSERT_STREQ("2.5", text[2]);
+    ASSERT_STREQ("2024-02-09", text[3]);
+    ASSERT_STREQ("2024-02-09 03:04:05.12", text[4]);
+    ASSERT_EQ(SQL_NULL_DATA, indicator[5]);
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_UNBIND);
+
+    // SQLGetData goes the same way, wide too
+    execDirectAndFetch("select i, d, r, dt, ts, n from t1");
+    char16_t wide[64];
+    SQLLEN   length = 0;
+    RETCODE ret = SQLGetData(stmt, 1, SQL_C_WCHAR, wide, sizeof(wide), &length);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(std::u16string(u"-1234567890123"), std::u16string(wide, length / 2));
+    ret = SQLGetData(stmt, 5, SQL_C_CHAR, text[0], sizeof(text[0]), &length);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_STREQ("2024-02-09 03:04:05.12", text[0]);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, ParallelFetch)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, b varchar(20), c timestamp)");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, 'row ' || ?, timestamp('2024-02-09 03:04:05'))", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 3000; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    // SQL_ATTR_NUODB_PARALLEL_FETCH: rowsets of 1000 rows and up
+    const SQLULEN ROWS = 1000;
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_NUODB_PARALLEL_FETCH, (SQLPOINTER)ROWS, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    SQLULEN fetched = 0;
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+
+    std::vector<SQLINTEGER> a(ROWS);
+    std::vector<char16_t>   b(ROWS * 32);
+    std::vector<char>       c(ROWS * 32);
+    std::vector<SQLLEN>     aInd(ROWS), bInd(ROWS), cInd(ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a.data(), 0, aInd.data()));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 2, SQL_C_WCHAR, b.data(), 32 * sizeof(char16_t), bInd.data()));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 3, SQL_C_CHAR, c.data(), 32, cInd.data()));
+
+    execDirect("select a, b, c from t1 order by a");
+
+    int rows = 0;
+    while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+        ASSERT_EQ(SQL_SUCCESS, ret);
+        for (SQLULEN n = 0; n < fetched; n++) {
+            int expected = rows + 1;
+            ASSERT_EQ(expected, a[n]);
+            std::string text = "row " + std::to_string(expected);
+            ASSERT_EQ(std::u16string(text.begin(), text.end()), std::u16string(&b[n * 32], bInd[n] / 2));
+            ASSERT_STREQ("2024-02-09 03:04:05", &c[n * 32]);
+            rows++;
+        }
+    }
+    ASSERT_EQ(3000, rows);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, GetDataOnBlockCursor)
+{
+    SQLUINTEGER extensions = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetInfo(hdbc1, SQL_GETDATA_EXTENSIONS, &extensions, sizeof(extensions), NULL));
+    ASSERT_EQ((SQLUINTEGER)(SQL_GD_ANY_ORDER | SQL_GD_BLOCK | SQL_GD_BOUND), extensions & (SQL_GD_ANY_ORDER | SQL_GD_BLOCK | SQL_GD_BOUND));
+
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, b clob)");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, 'clob ' || ?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 250; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    const SQLULEN ROWS = 100;
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    SQLULEN fetched = 0;
+    ret = SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+
+    std::vector<SQLINTEGER> a(ROWS);
+    std::vector<SQLLEN>     aInd(ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a.data(), 0, aInd.data()));
+
+    execDirect("select a, b from t1 order by a");
+
+    int rows = 0;
+    while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+        ASSERT_EQ(SQL_SUCCESS, ret);
+
+        // the rows of the rowset backwards, the unbound column before the
+        // bound one
+        for (SQLULEN n = fetched; n > 0; n--) {
+            int expected = rows + (int)n;
+            ASSERT_EQ(SQL_SUCCESS, SQLSetPos(stmt, n, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+
+            char   clob[32];
+            SQLLEN indicator = 0;
+            ASSERT_EQ(SQL_SUCCESS, SQLGetData(stmt, 2, SQL_C_CHAR, clob, sizeof(clob), &indicator));
+            ASSERT_EQ("clob " + std::to_string(expected), std::string(clob, indicator));
+
+            // a bound column only on the cursor's row, the last of a full
+            // rowset: the others aren't kept
+            SQLINTEGER bound = 0;
+            ret = SQLGetData(stmt, 1, SQL_C_LONG, &bound, 0, &indicator);
+            if (n == ROWS) {
+                ASSERT_EQ(SQL_SUCCESS, ret);
+                ASSERT_EQ(expected, bound);
+            } else {
+                ASSERT_EQ(SQL_ERROR, ret);
+            }
+            ASSERT_EQ(expected, a[n - 1]);
+        }
+
+        ASSERT_EQ(SQL_ERROR, SQLSetPos(stmt, fetched + 1, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+        SQLINTEGER  native;
+        SQLCHAR     state[6];
+        ASSERT_EQ(SQL_SUCCESS, SQLGetDiagRec(SQL_HANDLE_STMT, stmt, 1, state, &native, NULL, 0, NULL));
+        ASSERT_STREQ("HY107", (char*)state);
+
+        rows += (int)fetched;
+    }
+    ASSERT_EQ(250, rows);
+    freeStmt();
+
+    // every column bound: nothing is kept, so SQLGetData reads only the
+    // cursor's row
+    std::vector<SQLCHAR> b(ROWS * 32);
+    std::vector<SQLLEN>  bInd(ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 2, SQL_C_CHAR, b.data(), 32, bInd.data()));
+    execDirect("select a, b from t1 order by a");
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ(ROWS, fetched);
+    SQLINTEGER bound = 0;
+    SQLLEN     indicator = 0;
+    ASSERT_EQ(SQL_ERROR, SQLGetData(stmt, 1, SQL_C_LONG, &bound, 0, &indicator));
+    SQLINTEGER native;
+    SQLCHAR    state[6];
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagRec(SQL_HANDLE_STMT, stmt, 1, state, &native, NULL, 0, NULL));
+    ASSERT_STREQ("HY109", (char*)state);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLSetPos(stmt, ROWS, SQL_POSITION, SQL_LOCK_NO_CHANGE));
+    char clob[32];
+    ASSERT_EQ(SQL_SUCCESS, SQLGetData(stmt, 2, SQL_C_CHAR, clob, sizeof(clob), &indicator));
+    ASSERT_EQ("clob " + std::to_string(ROWS), std::string(clob, indicator));
+    ASSERT_EQ(SQL_SUCCESS, SQLGetData(stmt, 1, SQL_C_LONG, &bound, 0, &indicator));
+    ASSERT_EQ((SQLINTEGER)ROWS, bound);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, RetrieveDataOff)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer)");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 25; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    const SQLULEN ROWS = 10;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0));
+    SQLULEN      fetched = 0;
+    SQLUSMALLINT status[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, status, 0));
+
+    SQLINTEGER a[ROWS];
+    SQLLEN     aInd[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a, 0, aInd));
+
+    ASSERT_EQ(SQL_ERROR, SQLSetStmtAttr(stmt, SQL_ATTR_RETRIEVE_DATA, (SQLPOINTER)5, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_RETRIEVE_DATA, (SQLPOINTER)SQL_RD_OFF, 0));
+    SQLULEN retrieve = SQL_RD_ON;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_RETRIEVE_DATA, &retrieve, 0, NULL));
+    ASSERT_EQ((SQLULEN)SQL_RD_OFF, retrieve);
+
+    execDirect("select a from t1 order by a");
+
+    // skip the first rowset: nothing is stored
+    a[0] = -1;
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ(ROWS, fetched);
+    ASSERT_EQ(SQL_ROW_SUCCESS, status[ROWS - 1]);
+    ASSERT_EQ(-1, a[0]);
+
+    // then read the next
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_RETRIEVE_DATA, (SQLPOINTER)SQL_RD_ON, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ(ROWS, fetched);
+    for (SQLULEN n = 0; n < ROWS; n++) {
+        ASSERT_EQ((SQLINTEGER)(ROWS + n + 1), a[n]);
+    }
+
+    // and count the rest
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_RETRIEVE_DATA, (SQLPOINTER)SQL_RD_OFF, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ((SQLULEN)5, fetched);
+    ASSERT_EQ(SQL_ROW_SUCCESS, status[4]);
+    ASSERT_EQ(SQL_NO_DATA, status[5]);
+    ASSERT_EQ(SQL_NO_DATA, SQLFetch(stmt));
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, StaticCursorScroll)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, b varchar(20))");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, 'row ' || ?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 25; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    SQLUINTEGER attributes = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetInfo(hdbc1, SQL_STATIC_CURSOR_ATTRIBUTES1, &attributes, sizeof(attributes), NULL));
+    ASSERT_EQ((SQLUINTEGER)(SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE), attributes & (SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE));
+
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_STATIC, 0));
+    // SQL_ATTR_NUODB_CURSOR_MEMORY: spill every row to the file
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_NUODB_CURSOR_MEMORY, (SQLPOINTER)0, 0));
+
+    const SQLULEN ROWS = 10;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0));
+    SQLULEN fetched = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+
+    SQLINTEGER a[ROWS];
+    SQLLEN     aInd[ROWS];
+    char       b[ROWS][20];
+    SQLLEN     bInd[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a, 0, aInd));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 2, SQL_C_CHAR, b, sizeof(b[0]), bInd));
+
+    execDirect("select a, b from t1 order by a");
+
+    auto expectRowset = [&](int first, SQLULEN count) {
+        ASSERT_EQ(count, fetched);
+        for (SQLULEN n = 0; n < count; n++) {
+            ASSERT_EQ(first + (int)n, a[n]);
+            ASSERT_EQ("row " + std::to_string(first + n), std::string(b[n], bInd[n]));
+        }
+    };
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0));
+    expectRowset(1, ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_LAST, 0));
+    expectRowset(16, ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_PRIOR, 0));
+    expectRowset(6, ROWS);
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_ABSOLUTE, 3));
+    expectRowset(3, ROWS);
+
+    SQLULEN number = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_ROW_NUMBER, &number, 0, NULL));
+    ASSERT_EQ((SQLULEN)3, number);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_RELATIVE, 20));
+    expectRowset(23, 3);
+    ASSERT_EQ(SQL_NO_DATA, SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_ABSOLUTE, -10));
+    expectRowset(16, ROWS);
+
+    // a rowset that would start before the first row starts at it
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_ABSOLUTE, 3));
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, SQLFetchScroll(stmt, SQL_FETCH_RELATIVE, -5));
+    expectRowset(1, ROWS);
+    ASSERT_EQ(SQL_NO_DATA, SQLFetchScroll(stmt, SQL_FETCH_PRIOR, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_NEXT, 0));
+    expectRowset(1, ROWS);
+
+    ASSERT_EQ(SQL_ERROR, SQLFetchScroll(stmt, SQL_FETCH_BOOKMARK, 0));
+    freeStmt();
+
+    // a forward-only cursor only moves forward
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_FORWARD_ONLY, 0));
+    execDirect("select a, b from t1 order by a");
+    ASSERT_EQ(SQL_ERROR, SQLFetchScroll(stmt, SQL_FETCH_LAST, 0));
+    SQLINTEGER native;
+    SQLCHAR    state[6];
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagRec(SQL_HANDLE_STMT, stmt, 1, state, &native, NULL, 0, NULL));
+    ASSERT_STREQ("HY106", (char*)state);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, KeysetCursor)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer primary key, b varchar(20))");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, 'row ' || ?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 25; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_KEYSET_DRIVEN, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_KEYSET_SIZE, (SQLPOINTER)10, 0));
+    SQLULEN keysetSize = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_KEYSET_SIZE, &keysetSize, 0, NULL));
+    ASSERT_EQ((SQLULEN)10, keysetSize);
+
+    const SQLULEN ROWS = 5;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0));
+    SQLULEN      fetched = 0;
+    SQLUSMALLINT status[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, status, 0));
+
+    SQLINTEGER a[ROWS];
+    SQLLEN     aInd[ROWS];
+    char       b[ROWS][20];
+    SQLLEN     bInd[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a, 0, aInd));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 2, SQL_C_CHAR, b, sizeof(b[0]), bInd));
+
+    execDirect("select a, b from t1 order by a");
+
+    SQLULEN type = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, &type, 0, NULL));
+    ASSERT_EQ((SQLULEN)SQL_CURSOR_KEYSET_DRIVEN, type);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_ABSOLUTE, 11));
+    ASSERT_EQ(ROWS, fetched);
+    ASSERT_EQ(11, a[0]);
+    ASSERT_EQ("row 11", std::string(b[0], bInd[0]));
+
+    // another statement changes the rows: the keyset cursor sees that
+    SQLHSTMT other;
+    ASSERT_EQ(SQL_SUCCESS, SQLAllocHandle(SQL_HANDLE_STMT, hdbc1, &other));
+    ASSERT_EQ(SQL_SUCCESS, SQLExecDirect(other, (SQLCHAR*)"update t1 set b = 'updated' where a = 2", SQL_NTS));
+    ASSERT_EQ(SQL_SUCCESS, SQLExecDirect(other, (SQLCHAR*)"delete from t1 where a = 3", SQL_NTS));
+    SQLFreeHandle(SQL_HANDLE_STMT, other);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_FIRST, 0));
+    ASSERT_EQ(ROWS, fetched);
+    ASSERT_EQ(2, a[1]);
+    ASSERT_EQ("updated", std::string(b[1], bInd[1]));
+    ASSERT_EQ(SQL_ROW_DELETED, status[2]);
+    ASSERT_EQ(SQL_ROW_SUCCESS, status[3]);
+    ASSERT_EQ(4, a[3]);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLFetchScroll(stmt, SQL_FETCH_LAST, 0));
+    ASSERT_EQ(21, a[0]);
+    ASSERT_EQ(25, a[ROWS - 1]);
+    freeStmt();
+
+    // without a primary key to keep the cursor is static
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, SQLExecDirect(stmt, (SQLCHAR*)"select b from t1 union select b from t1", SQL_NTS));
+    ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_CURSOR_TYPE, &type, 0, NULL));
+    ASSERT_EQ((SQLULEN)SQL_CURSOR_STATIC, type);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, MaxRows)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer)");
+    execDirect("insert into t1 values (1), (2), (3), (4), (5), (6), (7), (8)");
+    freeStmt();
+
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_MAX_ROWS, (SQLPOINTER)3, 0));
+
+    SQLINTEGER a = 0;
+    SQLLEN     aInd = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, &a, 0, &aInd));
+
+    execDirect("select a from t1 order by a");
+    for (int n = 1; n <= 3; n++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+        ASSERT_EQ(n, a);
+    }
+    ASSERT_EQ(SQL_NO_DATA, SQLFetch(stmt));
+    ASSERT_EQ(SQL_NO_DATA, SQLFetch(stmt));
+    freeStmt();
+
+    // a block cursor stops at the limit too
+    const SQLULEN ROWS = 5;
+    SQLINTEGER    block[ROWS];
+    SQLLEN        blockInd[ROWS];
+    SQLULEN       fetched = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, block, 0, blockInd));
+
+    execDirect("select a from t1 order by a");
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ((SQLULEN)3, fetched);
+    ASSERT_EQ(SQL_NO_DATA, SQLFetch(stmt));
+    freeStmt();
+
+    // and the limit is gone for the next execution without it
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_MAX_ROWS, (SQLPOINTER)0, 0));
+    execDirect("select a from t1 order by a");
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ(ROWS, fetched);
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ((SQLULEN)3, fetched);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, FetchSize)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer)");
+
+    SQLINTEGER value = 0;
+    RETCODE ret = SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?)", SQL_NTS);
+    ASSERT_EQ(SQL_SUCCESS, ret);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &value, 0, NULL));
+    for (value = 1; value <= 1000; value++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    // SQL_ATTR_NUODB_FETCH_SIZE: a number of rows, or adaptive
+    const SQLULEN ADAPTIVE = (SQLULEN)-1;
+    for (SQLULEN fetchSize : { (SQLULEN)7, ADAPTIVE }) {
+        ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_NUODB_FETCH_SIZE, (SQLPOINTER)fetchSize, 0));
+        SQLULEN current = 0;
+        ASSERT_EQ(SQL_SUCCESS, SQLGetStmtAttr(stmt, SQL_ATTR_NUODB_FETCH_SIZE, &current, 0, NULL));
+        ASSERT_EQ(fetchSize, current);
+
+        // adaptive mode learns from each execution
+        ASSERT_EQ(SQL_SUCCESS, SQLPrepare(stmt, (SQLCHAR*)"select a from t1 order by a", SQL_NTS));
+        for (int execution = 0; execution < 3; execution++) {
+            ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+            SQLINTEGER a = 0;
+            SQLLEN     aInd = 0;
+            int        rows = 0;
+            while ((ret = SQLFetch(stmt)) != SQL_NO_DATA) {
+                ASSERT_EQ(SQL_SUCCESS, ret);
+                ASSERT_EQ(SQL_SUCCESS, SQLGetData(stmt, 1, SQL_C_LONG, &a, 0, &aInd));
+                ASSERT_EQ(++rows, a);
+            }
+            ASSERT_EQ(1000, rows);
+            freeStmt();
+        }
+    }
+}
+
+TEST_F(ODBCTestRequiresChorus, ColumnSizes)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(name varchar(40), code char(3), note string, n integer)");
+    execDirect("insert into t1 values ('ab', 'x', 'y', 1)");
+
+    // sizes are known from the declaration once the statement is prepared,
+    // and don't change with the data once it's executed
+    ASSERT_EQ(SQL_SUCCESS, SQLPrepare(stmt, (SQLCHAR*)"select name, code, note, n from t1", SQL_NTS));
+
+    SQLCHAR     name[64];
+    SQLSMALLINT nameLength = 0;
+    SQLSMALLINT sqlType = 0;
+    SQLULEN     columnSize = 0;
+    SQLSMALLINT scale = 0;
+    SQLSMALLINT nullable = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLDescribeCol(stmt, 1, name, sizeof(name), &nameLength, &sqlType, &columnSize, &scale, &nullable));
+    ASSERT_EQ(SQL_VARCHAR, sqlType);
+    ASSERT_EQ((SQLULEN)40, columnSize);
+    ASSERT_EQ(SQL_SUCCESS, SQLDescribeCol(stmt, 2, name, sizeof(name), &nameLength, &sqlType, &columnSize, &scale, &nullable));
+    ASSERT_EQ(SQL_CHAR, sqlType);
+    ASSERT_EQ((SQLULEN)3, columnSize);
+    ASSERT_EQ(SQL_SUCCESS, SQLDescribeCol(stmt, 3, name, sizeof(name), &nameLength, &sqlType, &columnSize, &scale, &nullable));
+    ASSERT_EQ(SQL_LONGVARCHAR, sqlType);
+
+    // SQLColAttribute agrees, with room for the widest characters in bytes
+    SQLLEN value = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 1, SQL_DESC_CONCISE_TYPE, NULL, 0, NULL, &value));
+    ASSERT_EQ(SQL_VARCHAR, value);
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 1, SQL_DESC_LENGTH, NULL, 0, NULL, &value));
+    ASSERT_EQ(40, value);
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 1, SQL_DESC_DISPLAY_SIZE, NULL, 0, NULL, &value));
+    ASSERT_EQ(40, value);
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 1, SQL_DESC_OCTET_LENGTH, NULL, 0, NULL, &value));
+    ASSERT_EQ(160, value);
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 4, SQL_DESC_OCTET_LENGTH, NULL, 0, NULL, &value));
+    ASSERT_EQ((SQLLEN)sizeof(SQLINTEGER), value);
+
+    ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    ASSERT_EQ(SQL_SUCCESS, SQLDescribeCol(stmt, 1, name, sizeof(name), &nameLength, &sqlType, &columnSize, &scale, &nullable));
+    ASSERT_EQ(SQL_VARCHAR, sqlType);
+    ASSERT_EQ((SQLULEN)40, columnSize);
+    ASSERT_EQ(SQL_SUCCESS, SQLColAttribute(stmt, 1, SQL_DESC_LENGTH, NULL, 0, NULL, &value));
+    ASSERT_EQ(40, value);
+    ASSERT_EQ(SQL_SUCCESS, SQLDescribeCol(stmt, 2, name, sizeof(name), &nameLength, &sqlType, &columnSize, &scale, &nullable));
+    ASSERT_EQ((SQLULEN)3, columnSize);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, MemoryAccounting)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, s string)");
+
+    SQLINTEGER  a = 0;
+    std::string s(10000, 'x');
+    ASSERT_EQ(SQL_SUCCESS, SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, ?)", SQL_NTS));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &a, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR, s.size(), 0, &s[0], s.size(), NULL));
+    for (a = 1; a <= 100; a++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    }
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    // SQL_ATTR_NUODB_MEMORY_USAGE: a cursor left part read, with a value
+    // part read, holds nothing once it's closed
+    char     text[32];
+    SQLLEN   textInd = 0;
+    SQLCHAR  usage[256];
+    ASSERT_EQ(SQL_SUCCESS, SQLPrepare(stmt, (SQLCHAR*)"select a, s from t1 order by a", SQL_NTS));
+    for (int execution = 0; execution < 20; execution++) {
+        ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+        ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+        ASSERT_EQ(SQL_SUCCESS_WITH_INFO, SQLGetData(stmt, 2, SQL_C_CHAR, text, sizeof(text), &textInd));
+        ASSERT_EQ(SQL_SUCCESS, SQLCloseCursor(stmt));
+        ASSERT_EQ(SQL_SUCCESS, SQLGetConnectAttr(hdbc1, SQL_ATTR_NUODB_MEMORY_USAGE, usage, sizeof(usage), NULL));
+        ASSERT_EQ(0, strncmp((char*)usage, "parameters=0;getdata=0;rowsets=0;prefetch=0;cursors=0;", 55)) << usage;
+    }
+
+    // SQL_ATTR_NUODB_MEMORY_LIMIT: a value that won't fit isn't kept
+    ASSERT_EQ(SQL_SUCCESS, SQLSetConnectAttr(hdbc1, SQL_ATTR_NUODB_MEMORY_LIMIT, (SQLPOINTER)1000, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    ASSERT_EQ(SQL_ERROR, SQLGetData(stmt, 2, SQL_C_CHAR, text, sizeof(text), &textInd));
+    SQLCHAR    state[6];
+    SQLINTEGER native = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagRec(SQL_HANDLE_STMT, stmt, 1, state, &native, NULL, 0, NULL));
+    ASSERT_STREQ("HY001", (char*)state);
+    ASSERT_EQ(SQL_SUCCESS, SQLSetConnectAttr(hdbc1, SQL_ATTR_NUODB_MEMORY_LIMIT, (SQLPOINTER)0, 0));
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, RowErrors)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, s string)");
+    execDirect("insert into t1 values (1, '1'), (2, 'two'), (3, '3'), (4, '4')");
+
+    const SQLULEN ROWS = 4;
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)ROWS, 0));
+    SQLULEN      fetched = 0;
+    SQLUSMALLINT status[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROWS_FETCHED_PTR, &fetched, 0));
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_STATUS_PTR, status, 0));
+
+    SQLINTEGER a[ROWS], s[ROWS];
+    SQLLEN     aInd[ROWS], sInd[ROWS];
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_LONG, a, 0, aInd));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 2, SQL_C_LONG, s, 0, sInd));
+
+    // the row that won't convert is marked, and the rest of the rowset is
+    // still there
+    execDirect("select a, s from t1 order by a");
+    ASSERT_EQ(SQL_SUCCESS_WITH_INFO, SQLFetch(stmt));
+    ASSERT_EQ(ROWS, fetched);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[0]);
+    EXPECT_EQ(SQL_ROW_ERROR, status[1]);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[2]);
+    EXPECT_EQ(SQL_ROW_SUCCESS, status[3]);
+    EXPECT_EQ(2, a[1]);
+    EXPECT_EQ(3, s[2]);
+    EXPECT_EQ(4, s[3]);
+
+    SQLLEN     rowNumber = 0;
+    SQLINTEGER columnNumber = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagField(SQL_HANDLE_STMT, stmt, 1, SQL_DIAG_ROW_NUMBER, &rowNumber, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagField(SQL_HANDLE_STMT, stmt, 1, SQL_DIAG_COLUMN_NUMBER, &columnNumber, 0, NULL));
+    EXPECT_EQ(2, rowNumber);
+    EXPECT_EQ(2, columnNumber);
+    ASSERT_EQ(SQL_NO_DATA, SQLFetch(stmt));
+    freeStmt();
+
+    // a row at a time, the one row failing fails the fetch
+    ASSERT_EQ(SQL_SUCCESS, SQLSetStmtAttr(stmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0));
+    execDirect("select a, s from t1 where a = 2");
+    ASSERT_EQ(SQL_ERROR, SQLFetch(stmt));
+    EXPECT_EQ(SQL_ROW_ERROR, status[0]);
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagField(SQL_HANDLE_STMT, stmt, 1, SQL_DIAG_ROW_NUMBER, &rowNumber, 0, NULL));
+    EXPECT_EQ(1, rowNumber);
+    freeStmt();
+}
+
+TEST_F(ODBCTestRequiresChorus, HexBinary)
+{
+    execDirect("drop table t1 if exists");
+    execDirect("create table t1(a integer, b varbinary(100), c blob)");
+
+    // binary parameters sent as hex text, in either case
+    const char* hex = "00ff10Ab7F";
+    SQLINTEGER  a = 1;
+    SQLLEN      nts = SQL_NTS;
+    ASSERT_EQ(SQL_SUCCESS, SQLPrepare(stmt, (SQLCHAR*)"insert into t1 values (?, ?, ?)", SQL_NTS));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 1, SQL_PARAM_INPUT, SQL_C_LONG, SQL_INTEGER, 0, 0, &a, 0, NULL));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARBINARY, 100, 0, (SQLPOINTER)hex, 0, &nts));
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 3, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_LONGVARBINARY, 100, 0, (SQLPOINTER)hex, 0, &nts));
+    ASSERT_EQ(SQL_SUCCESS, SQLExecute(stmt));
+
+    // an odd number of digits, or something else, is refused
+    SQLCHAR    state[6];
+    SQLINTEGER native = 0;
+    a = 2;
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARBINARY, 100, 0, (SQLPOINTER)"00f", 0, &nts));
+    ASSERT_EQ(SQL_ERROR, SQLExecute(stmt));
+    ASSERT_EQ(SQL_SUCCESS, SQLGetDiagRec(SQL_HANDLE_STMT, stmt, 1, state, &native, NULL, 0, NULL));
+    ASSERT_STREQ("22018", (char*)state);
+    ASSERT_EQ(SQL_SUCCESS, SQLBindParameter(stmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARBINARY, 100, 0, (SQLPOINTER)"0x00", 0, &nts));
+    ASSERT_EQ(SQL_ERROR, SQLExecute(stmt));
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_RESET_PARAMS);
+
+    // bound: the whole value
+    char   bound[32];
+    SQLLEN boundInd = 0;
+    ASSERT_EQ(SQL_SUCCESS, SQLBindCol(stmt, 1, SQL_C_CHAR, bound, sizeof(bound), &boundInd));
+    execDirect("select b from t1");
+    ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+    EXPECT_EQ(10, boundInd);
+    EXPECT_STREQ("00FF10AB7F", bound);
+    freeStmt();
+    SQLFreeStmt(stmt, SQL_UNBIND);
+
+    // SQLGetData: pieces of three digits, ending half way through a byte
+    for (int column = 1; column <= 2; column++) {
+        execDirect("select b, c from t1");
+        ASSERT_EQ(SQL_SUCCESS, SQLFetch(stmt));
+
+        std::string text;
+        char        piece[4];
+        SQLLEN      indicator = 0;
+        RETCODE     ret;
+        while ((ret = SQLGetData(stmt, column, SQL_C_CHAR, piece, sizeof(piece), &indicator)) != SQL_NO_DATA) {
+            ASSERT_TRUE(SQL_SUCCEEDED(ret));
+            text += piece;
+        }
+        EXPECT_EQ("00FF10AB7F", text) << column;
+        freeStmt();
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ClientGate.h"
+#include "FakeResultSet.h"
+#include "MemoryAccount.h"
+#include "PrefetchResultSet.h"
+
+// Rows 0, 1, 2... of one integer column, with a hook on each read.
+class CountingResultSet : public FakeResultSet
+{
+public:
+    explicit CountingResultSet(int count)
+        : FakeResultSet({ StagedKind::Integer }, makeRows(count))
+    {}
+
+    virtual bool next()
+    {
+        if (failAt >= 0 && reads == failAt) {
+            throw std::runtime_error("lost the connection");
+        }
+        if (inCall && *inCall) {
+            overlapped = true;
+        }
+        ++reads;
+        return FakeResultSet::next();
+    }
+
+    std::atomic<int>   reads { 0 };
+    int                failAt = -1;
+    std::atomic<bool>* inCall = nullptr;   // an application call is in progress
+    std::atomic<bool>  overlapped { false };
+
+private:
+    static std::vector<StagedRow> makeRows(int count)
+    {
+        std::vector<StagedRow> rows(count);
+        for (int n = 0; n < count; ++n) {
+            rows[n].push_back(integer(n));
+        }
+        return rows;
+    }
+};
+
+// Each read waits until it's let go.
+class BlockedResultSet : public FakeResultSet
+{
+public:
+    BlockedResultSet()
+        : FakeResultSet({ StagedKind::Integer }, {})
+    {}
+
+    virtual bool next()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        reading = true;
+        changed.notify_all();
+        changed.wait(lock, [this] { return released; });
+        return false;
+    }
+
+    void waitForRead()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return reading; });
+    }
+
+    void letGo()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+        changed.notify_all();
+    }
+
+private:
+    std::mutex              mutex;
+    std::condition_variable changed;
+    bool                    reading = false;
+    bool                    released = false;
+};
+
+TEST(PrefetchResultSetTest, RowsInOrder)
+{
+    CountingResultSet base(1000);
+    MemoryAccount     account;
+    auto*             prefetch = new PrefetchResultSet(&base, { StagedKind::Integer }, 7, nullptr, &account);
+
+    for (int n = 0; n < 1000; ++n) {
+        ASSERT_TRUE(prefetch->next()) << n;
+        ASSERT_EQ(n, prefetch->getInt(1));
+    }
+    EXPECT_FALSE(prefetch->next());
+    EXPECT_FALSE(prefetch->next());
+
+    prefetch->release();
+    EXPECT_EQ((size_t)0, account.getUsed(MemoryUse::Prefetch));
+}
+
+TEST(PrefetchResultSetTest, ErrorAfterRows)
+{
+    CountingResultSet base(100);
+    base.failAt = 10;
+    auto* prefetch = new PrefetchResultSet(&base, { StagedKind::Integer }, 4, nullptr);
+
+    // the rows read before the error still arrive
+    for (int n = 0; n < 10; ++n) {
+        ASSERT_TRUE(prefetch->next()) << n;
+        ASSERT_EQ(n, prefetch->getInt(1));
+    }
+    EXPECT_THROW(prefetch->next(), std::runtime_error);
+    EXPECT_FALSE(prefetch->next());
+
+    prefetch->release();
+}
+
+TEST(PrefetchResultSetTest, TakesTurnsWithCalls)
+{
+    ClientGate        gate;
+    std::atomic<bool> inCall { false };
+    CountingResultSet base(500);
+    base.inCall = &inCall;
+
+    PrefetchResultSet* prefetch;
+    {
+        // nothing is read while a call is in progress...
+        ClientGate::Use use(&gate);
+        inCall = true;
+        prefetch = new PrefetchResultSet(&base, { StagedKind::Integer }, 10, nullptr, nullptr, &gate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(0, base.reads);
+        inCall = false;
+
+        // ...unless the call is waiting for the rows
+        ASSERT_TRUE(prefetch->next());
+        EXPECT_EQ(0, prefetch->getInt(1));
+    }
+
+    for (int n = 1; n < 500; ++n) {
+        ClientGate::Use use(&gate);
+        inCall = true;
+        std::this_thread::yield();
+        inCall = false;
+        ASSERT_TRUE(prefetch->next()) << n;
+        ASSERT_EQ(n, prefetch->getInt(1));
+    }
+    {
+        ClientGate::Use use(&gate);
+        EXPECT_FALSE(prefetch->next());
+        prefetch->release();
+    }
+    EXPECT_FALSE(base.overlapped);
+}
+
+TEST(PrefetchResultSetTest, CancelWakesNext)
+{
+    BlockedResultSet base;
+    auto*            prefetch = new PrefetchResultSet(&base, { StagedKind::Integer }, 10, nullptr);
+    base.waitForRead();
+
+    // next() returns even though the producer's read hasn't
+    std::thread canceler([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        prefetch->cancel();
+    });
+    EXPECT_FALSE(prefetch->next());
+    canceler.join();
+
+    base.letGo();
+    prefetch->release();
+}
@@ -0,0 +1,254 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FakeResultSet.h"
+#include "ResultExport.h"
+
+using namespace ResultExport;
+
+static CsvColumn csvColumn(CsvKind kind, const char* name, TextFormat::TextKind text = TextFormat::TextKind::None)
+{
+    CsvColumn csv;
+    csv.kind = kind;
+    csv.name = name;
+    csv.text = text;
+    csv.numeric = text != TextFormat::TextKind::None;
+    return csv;
+}
+
+static ArrowExport::ArrowColumn arrowColumn(ArrowExport::ArrowKind kind, const char* name, const char* format)
+{
+    ArrowExport::ArrowColumn arrow;
+    arrow.kind = kind;
+    arrow.name = name;
+    arrow.format = format;
+    return arrow;
+}
+
+// A temporary file to write to, read back whole.
+class TempFile
+{
+public:
+    TempFile() : file(tmpfile()) {}
+    ~TempFile()
+    {
+        if (file) {
+            fclose(file);
+        }
+    }
+
+    int getFd() const { return fileno(file); }
+
+    std::string read()
+    {
+        std::string contents;
+        char        buffer[4096];
+        size_t      length;
+
+        rewind(file);
+        while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            contents.append(buffer, length);
+        }
+        return contents;
+    }
+
+    FILE* file;
+};
+
+// Where a field of a FlatBuffers table in an Arrow IPC message is, 0 if it's
+// absent.
+static uint32_t findField(const std::string& message, uint32_t table, int id)
+{
+    int32_t  back;
+    uint16_t vtableSize;
+    uint16_t offset = 0;
+
+    memcpy(&back, &message[table], 4);
+    uint32_t vtable = table - back;
+    memcpy(&vtableSize, &message[vtable], 2);
+    if (4 + 2 * id < vtableSize) {
+        memcpy(&offset, &message[vtable + 4 + 2 * id], 2);
+    }
+    return offset > 0 ? table + offset : 0;
+}
+
+static uint64_t getField(const std::string& message, uint32_t table, int id, int size)
+{
+    uint32_t field = findField(message, table, id);
+    uint64_t value = 0;
+
+    if (field > 0) {
+        memcpy(&value, &message[field], size);
+    }
+    return value;
+}
+
+// The table a field refers to: offsets are from the field.
+static uint32_t getTable(const std::string& message, uint32_t table, int id)
+{
+    uint32_t field = findField(message, table, id);
+    return field + (uint32_t)getField(message, table, id, 4);
+}
+
+class ResultExportTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        csvColumns = {
+            csvColumn(CsvKind::Typed, "ID", TextFormat::TextKind::Integer),
+            csvColumn(CsvKind::Text, "NAME"),
+            csvColumn(CsvKind::Typed, "RATIO", TextFormat::TextKind::Double),
+            csvColumn(CsvKind::Binary, "DATA"),
+        };
+        arrowColumns = {
+            arrowColumn(ArrowExport::ArrowKind::Int64, "ID", "l"),
+            arrowColumn(ArrowExport::ArrowKind::String, "NAME", "U"),
+            arrowColumn(ArrowExport::ArrowKind::Double, "RATIO", "g"),
+            arrowColumn(ArrowExport::ArrowKind::Binary, "DATA", "Z"),
+        };
+        std::vector<StagedKind> kinds = {
+            StagedKind::Integer, StagedKind::String, StagedKind::Real, StagedKind::Bytes,
+        };
+        std::vector<StagedRow> rows = {
+            { integer(1), text("plain"), real(0.5), text(std::string("\x01\xab", 2)) },
+            { integer(2), text("a,b"), null(), text("") },
+            { integer(3), text("say \"hi\""), real(2), null() },
+            { integer(4), text(""), real(-1.25), text("\xff") },
+            { integer(5), null(), real(0), text(std::string(1, '\0')) },
+        };
+        results.reset(new FakeResultSet(kinds, std::move(rows)));
+        memset(&options, 0, sizeof(options));
+    }
+
+    std::string writeCsv(size_t maxRows = SIZE_MAX, size_t expected = 5)
+    {
+        TempFile   file;
+        OutputFile output(file.getFd());
+        size_t     rows = 0;
+
+        EXPECT_TRUE(ResultExport::writeCsv(results.get(), csvColumns, nullptr, options, maxRows, output, &rows));
+        EXPECT_EQ(expected, rows);
+        return file.read();
+    }
+
+    std::vector<CsvColumn>                csvColumns;
+    std::vector<ArrowExport::ArrowColumn> arrowColumns;
+    std::unique_ptr<FakeResultSet>        results;
+    NuoODBCExportOptions                  options;
+};
+
+TEST_F(ResultExportTest, CsvDefaults)
+{
+    options.format = NUOODBC_EXPORT_CSV;
+    options.header = 1;
+
+    // an empty string or binary value is quoted to tell it from NULL
+    EXPECT_EQ("ID,NAME,RATIO,DATA\n"
+              "1,plain,0.5,01AB\n"
+              "2,\"a,b\",,\"\"\n"
+              "3,\"say \"\"hi\"\"\",2,\n"
+              "4,\"\",-1.25,FF\n"
+              "5,,0,00\n",
+              writeCsv());
+}
+
+TEST_F(ResultExportTest, CsvOptions)
+{
+    options.format = NUOODBC_EXPORT_CSV;
+    options.quoting = NUOODBC_QUOTE_NONNUMERIC;
+    options.delimiter = ';';
+    options.quote = '\'';
+    options.nullToken = "NULL";
+    options.lineEnd = "\r\n";
+
+    EXPECT_EQ("1;'plain';0.5;'01AB'\r\n"
+              "2;'a,b';NULL;''\r\n"
+              "3;'say \"hi\"';2;NULL\r\n"
+              "4;'';-1.25;'FF'\r\n"
+              "5;NULL;0;'00'\r\n",
+              writeCsv());
+
+    results->rewind();
+    options.quoting = NUOODBC_QUOTE_NONE;
+    EXPECT_EQ("1;plain;0.5;01AB\r\n"
+              "2;a,b;NULL;\r\n",
+              writeCsv(2, 2));
+}
+
+TEST_F(ResultExportTest, CsvNullToken)
+{
+    StagedRow row = { integer(1), text("NULL"), null(), null() };
+    results.reset(new FakeResultSet({ StagedKind::Integer, StagedKind::String, StagedKind::Real, StagedKind::Bytes },
+                                    { row }));
+    options.format = NUOODBC_EXPORT_CSV;
+    options.nullToken = "NULL";
+
+    EXPECT_EQ("1,\"NULL\",NULL,NULL\n", writeCsv(SIZE_MAX, 1));
+}
+
+TEST_F(ResultExportTest, ArrowIpc)
+{
+    TempFile   file;
+    OutputFile output(file.getFd());
+    size_t     rows = 0;
+
+    options.format = NUOODBC_EXPORT_ARROW_IPC;
+    options.batchRows = 3;
+    ASSERT_TRUE(writeArrowIpc(results.get(), arrowColumns, nullptr, options, SIZE_MAX, output, &rows));
+    EXPECT_EQ((size_t)5, rows);
+
+    // a schema, batches of 3 and 2 rows, and the end of the stream
+    std::string          stream = file.read();
+    size_t               at = 0;
+    std::vector<int>     headers;
+    std::vector<int64_t> lengths;
+    for (;;) {
+        uint32_t prefix[2];
+        ASSERT_LE(at + sizeof(prefix), stream.size());
+        memcpy(prefix, &stream[at], sizeof(prefix));
+        at += sizeof(prefix);
+        EXPECT_EQ(0xFFFFFFFF, prefix[0]);
+        if (prefix[1] == 0) {
+            break;
+        }
+        EXPECT_EQ(0u, prefix[1] % 8);
+
+        std::string message = stream.substr(at, prefix[1]);
+        uint32_t    root;
+        memcpy(&root, &message[0], 4);
+        EXPECT_EQ((uint64_t)4, getField(message, root, 0, 2));
+        headers.push_back((int)getField(message, root, 1, 1));
+        if (headers.back() == 3) {
+            lengths.push_back((int64_t)getField(message, getTable(message, root, 2), 0, 8));
+        }
+        at += prefix[1] + getField(message, root, 3, 8);
+    }
+
+    EXPECT_EQ(stream.size(), at);
+    EXPECT_EQ(std::vector<int>({ 1, 3, 3 }), headers);
+    EXPECT_EQ(std::vector<int64_t>({ 3, 2 }), lengths);
+}
+
+TEST_F(ResultExportTest, WriteError)
+{
+    OutputFile output(-1);
+    size_t     rows = 0;
+
+    options.format = NUOODBC_EXPORT_CSV;
+    EXPECT_FALSE(ResultExport::writeCsv(results.get(), csvColumns, nullptr, options, SIZE_MAX, output, &rows));
+    EXPECT_NE(0, output.getError());
+}
@@ -0,0 +1,175 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "FakeResultSet.h"
+#include "MemoryAccount.h"
+#include "StaticResultSet.h"
+
+#include "NuoRemote/Timestamp.h"
+
+// A fake result set that counts the times its cursor is closed.
+class ClosingResultSet : public FakeResultSet
+{
+public:
+    using FakeResultSet::FakeResultSet;
+
+    virtual void close() { ++closed; }
+
+    int closed = 0;
+};
+
+static const std::vector<StagedKind> kinds = { StagedKind::Integer, StagedKind::String, StagedKind::Timestamp };
+
+// Row n (1 based) holds n, its name, and a time n days and n microseconds
+// either side of the epoch; every seventh has no time.
+static std::vector<StagedRow> makeRows(int count, size_t width = 0)
+{
+    std::vector<StagedRow> rows;
+    for (int n = 1; n <= count; ++n) {
+        int64_t seconds = (n % 2 ? -1 : 1) * (int64_t)n * 86400;
+        std::string name = "row " + std::to_string(n);
+        name.resize(std::max(width, name.size()), '.');
+        rows.push_back({ integer(n), text(name), n % 7 ? dateTime(seconds, n * 1000) : null() });
+    }
+    return rows;
+}
+
+static void expectRow(StaticResultSet& results, int n, size_t width = 0)
+{
+    ASSERT_EQ(n, results.getInt(1));
+    std::string name = "row " + std::to_string(n);
+    name.resize(std::max(width, name.size()), '.');
+    ASSERT_STREQ(name.c_str(), results.getString(2));
+
+    NuoDB::Timestamp* timestamp = results.getTimestamp(3);
+    if (n % 7) {
+        ASSERT_NE(nullptr, timestamp) << n;
+        EXPECT_EQ((n % 2 ? -1 : 1) * (int64_t)n * 86400, timestamp->getSeconds()) << n;
+        EXPECT_EQ(n * 1000, timestamp->getNanos()) << n;
+        timestamp->release();
+        EXPECT_FALSE(results.wasNull());
+    } else {
+        EXPECT_EQ(nullptr, timestamp) << n;
+        EXPECT_TRUE(results.wasNull());
+    }
+}
+
+TEST(StaticResultSetTest, Next)
+{
+    ClosingResultSet base(kinds, makeRows(20));
+    StaticResultSet  results(&base, kinds, nullptr, DEFAULT_CURSOR_MEMORY, 0);
+
+    for (int n = 1; n <= 20; ++n) {
+        ASSERT_TRUE(results.next());
+        ASSERT_EQ((size_t)n, results.getPosition());
+        expectRow(results, n);
+    }
+    EXPECT_FALSE(results.next());
+    EXPECT_EQ((size_t)21, results.getPosition());
+    EXPECT_EQ((size_t)20, results.getRowCount());
+    EXPECT_EQ(0, base.closed);
+}
+
+TEST(StaticResultSetTest, Absolute)
+{
+    ClosingResultSet base(kinds, makeRows(20));
+    StaticResultSet  results(&base, kinds, nullptr, DEFAULT_CURSOR_MEMORY, 0);
+
+    // rows are read from the base only as far as they're wanted
+    ASSERT_TRUE(results.absolute(5));
+    expectRow(results, 5);
+    EXPECT_EQ((size_t)5, results.getRowsRead());
+
+    ASSERT_TRUE(results.absolute(2));
+    expectRow(results, 2);
+    ASSERT_TRUE(results.absolute(20));
+    expectRow(results, 20);
+    EXPECT_EQ((size_t)20, results.getRowsRead());
+
+    EXPECT_FALSE(results.absolute(21));
+    EXPECT_EQ((size_t)21, results.getPosition());
+    EXPECT_FALSE(results.absolute(0));
+    EXPECT_EQ((size_t)0, results.getPosition());
+
+    ASSERT_TRUE(results.absolute(7));
+    expectRow(results, 7);
+}
+
+// SQL_FETCH_RELATIVE moves from the cursor's position, as OdbcStatement
+// does it.
+TEST(StaticResultSetTest, Relative)
+{
+    ClosingResultSet base(kinds, makeRows(20));
+    StaticResultSet  results(&base, kinds, nullptr, DEFAULT_CURSOR_MEMORY, 0);
+
+    ASSERT_TRUE(results.absolute(10));
+    for (int step : { 3, -5, 1, -7 }) {
+        size_t row = results.getPosition() + step;
+        ASSERT_TRUE(results.absolute(row));
+        expectRow(results, (int)row);
+    }
+    EXPECT_EQ((size_t)2, results.getPosition());
+
+    // then next() carries on from there
+    ASSERT_TRUE(results.next());
+    expectRow(results, 3);
+
+    EXPECT_FALSE(results.absolute(results.getPosition() + 18));
+    EXPECT_EQ((size_t)21, results.getPosition());
+}
+
+TEST(StaticResultSetTest, MaxRows)
+{
+    ClosingResultSet base(kinds, makeRows(20));
+    StaticResultSet  results(&base, kinds, nullptr, DEFAULT_CURSOR_MEMORY, 8);
+
+    ASSERT_TRUE(results.absolute(8));
+    expectRow(results, 8);
+    EXPECT_EQ(0, base.closed);
+
+    // past the cap the base's cursor is closed, and there's nothing more
+    EXPECT_FALSE(results.absolute(9));
+    EXPECT_EQ(1, base.closed);
+    EXPECT_EQ((size_t)8, results.getRowCount());
+    EXPECT_FALSE(results.next());
+
+    ASSERT_TRUE(results.absolute(1));
+    expectRow(results, 1);
+    EXPECT_EQ(1, base.closed);
+}
+
+TEST(StaticResultSetTest, Spill)
+{
+    const size_t  width = 50 * 1024;
+    MemoryAccount account;
+    {
+        ClosingResultSet base(kinds, makeRows(100, width));
+        StaticResultSet  results(&base, kinds, nullptr, 2 * ROW_STORE_SEGMENT, 0, &account);
+
+        ASSERT_EQ((size_t)100, results.getRowCount());
+
+        // no more than the budget in memory, the rest in the spill file
+        EXPECT_EQ((size_t)2 * ROW_STORE_SEGMENT, results.getStore().getMemoryUsed());
+        EXPECT_EQ((size_t)2 * ROW_STORE_SEGMENT, account.getUsed(MemoryUse::Cursors));
+        EXPECT_GE(results.getStore().getSpilledBytes(), (size_t)(100 - 40) * width);
+
+        // in memory and spilled, either way
+        for (int n : { 100, 1, 60, 20, 99, 41 }) {
+            ASSERT_TRUE(results.absolute(n));
+            expectRow(results, n, width);
+        }
+        while (results.next()) {}
+        EXPECT_EQ((size_t)101, results.getPosition());
+    }
+    EXPECT_EQ((size_t)0, account.getUsed());
+}
@@ -0,0 +1,274 @@
+/**
+ * (C) Copyright NuoDB, Inc. 2026  All Rights Reserved.
+ *
+ * This software is licensed under the MIT License EXCEPT WHERE OTHERWISE NOTED!
+ * See the LICENSE file provided with this software.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "Transcoder.h"
+
+// Each kernel this CPU can run, with the one picked put back afterwards.
+class TranscoderTest : public ::testing::TestWithParam<const char*>
+{
+protected:
+    void SetUp() override
+    {
+        picked = Transcoder::getKernelName();
+        if (!Transcoder::useKernel(GetParam())) {
+            GTEST_SKIP() << GetParam() << " isn't supported here";
+        }
+    }
+
+    void TearDown() override { Transcoder::useKernel(picked); }
+
+    // Runs of ASCII, their lengths going either side of each kernel's block
+    // size, between code points of each length in UTF-8 and UTF-16.
+    static std::vector<uint32_t> makeCodePoints(size_t count)
+    {
+        static const uint32_t others[] = { 0x80, 0xE9, 0x7FF, 0x800, 0x20AC, 0xD7FF, 0xE000, 0xFFFD,
+                                           0xFFFF, 0x10000, 0x1F600, 0x10FFFF };
+        std::vector<uint32_t> codePoints;
+        for (size_t n = 0; codePoints.size() < count; ++n) {
+            for (size_t run = (n * 7) % 41; run > 0 && codePoints.size() < count; --run) {
+                codePoints.push_back('a' + (uint32_t)(codePoints.size() % 26));
+            }
+            if (codePoints.size() < count) {
+                codePoints.push_back(others[n % (sizeof(others) / sizeof(others[0]))]);
+            }
+        }
+        return codePoints;
+    }
+
+    static std::string toUtf8(const std::vector<uint32_t>& codePoints)
+    {
+        std::string text;
+        for (uint32_t c : codePoints) {
+            if (c < 0x80) {
+                text += (char)c;
+            } else if (c < 0x800) {
+                text += (char)(0xC0 | (c >> 6));
+                text += (char)(0x80 | (c & 0x3F));
+            } else if (c < 0x10000) {
+                text += (char)(0xE0 | (c >> 12));
+                text += (char)(0x80 | ((c >> 6) & 0x3F));
+                text += (char)(0x80 | (c & 0x3F));
+            } else {
+                text += (char)(0xF0 | (c >> 18));
+                text += (char)(0x80 | ((c >> 12) & 0x3F));
+                text += (char)(0x80 | ((c >> 6) & 0x3F));
+                text += (char)(0x80 | (c & 0x3F));
+            }
+        }
+        return text;
+    }
+
+    static std::u16string toUtf16(const std::vector<uint32_t>& codePoints)
+    {
+        std::u16string text;
+        for (uint32_t c : codePoints) {
+            if (c < 0x10000) {
+                text += (char16_t)c;
+            } else {
+                text += (char16_t)(0xD800 + ((c - 0x10000) >> 10));
+                text += (char16_t)(0xDC00 + ((c - 0x10000) & 0x3FF));
+            }
+        }
+        return text;
+    }
+
+    // Read text a piece at a time, as LobStream does: chunk more bytes at a
+    // time, into capacity units, carrying over what wasn't consumed.
+    static bool readPieces(const std::string& text, size_t chunk, size_t capacity, std::u16string& result)
+    {
+        std::vector<char16_t> out(capacity);
+        std::string           window;
+        size_t                read = 0;
+
+        result.clear();
+        while (read < text.size() || !window.empty()) {
+            size_t more = std::min(chunk, text.size() - read);
+            window.append(text, read, more);
+            read += more;
+
+            size_t   consumed;
+            size_t   written;
+            char16_t pending;
+            if (!Transcoder::utf8ToUtf16Piece(window.data(), window.size(), out.data(), capacity, &consumed, &written, &pending)) {
+                return false;
+            }
+            result.append(out.data(), written);
+            if (pending) {
+                result += pending;
+            }
+            window.erase(0, consumed);
+            if (!consumed && read == text.size()) {
+                return false;   // a sequence cut off at the end of the value
+            }
+        }
+        return true;
+    }
+
+    const char* picked = nullptr;
+};
+
+TEST_P(TranscoderTest, Whole)
+{
+    for (size_t count = 0; count <= 300; ++count) {
+        std::vector<uint32_t> codePoints = makeCodePoints(count);
+        std::string           text = toUtf8(codePoints);
+        std::u16string        converted;
+        ASSERT_TRUE(Transcoder::utf8ToUtf16(text.data(), text.size(), converted)) << count;
+        ASSERT_EQ(toUtf16(codePoints), converted) << count;
+    }
+}
+
+TEST_P(TranscoderTest, SameAsScalar)
+{
+    std::string    text = toUtf8(makeCodePoints(2000));
+    std::u16string converted;
+    ASSERT_TRUE(Transcoder::utf8ToUtf16(text.data(), text.size(), converted));
+
+    Transcoder::useKernel("scalar");
+    std::u16string scalar;
+    ASSERT_TRUE(Transcoder::utf8ToUtf16(text.data(), text.size(), scalar));
+    EXPECT_EQ(scalar, converted);
+}
+
+TEST_P(TranscoderTest, Truncated)
+{
+    std::vector<uint32_t> codePoints = makeCodePoints(120);
+    std::string           text = toUtf8(codePoints);
+    std::u16string        whole = toUtf16(codePoints);
+
+    // every capacity: a prefix is stored, a surrogate pair is never split,
+    // and the whole length is still measured
+    for (size_t capacity = 0; capacity <= whole.size() + 1; ++capacity) {
+        std::vector<char16_t> out(capacity + 1, u'?');
+        size_t                written;
+        size_t                required;
+        ASSERT_TRUE(Transcoder::utf8ToUtf16(text.data(), text.size(), out.data(), capacity, &written, &required)) << capacity;
+        ASSERT_EQ(whole.size(), required) << capacity;
+        ASSERT_LE(written, capacity);
+        ASSERT_GE(written + 1, std::min(capacity, whole.size())) << capacity;
+        ASSERT_EQ(whole.substr(0, written), std::u16string(out.data(), written)) << capacity;
+        if (written) {
+            ASSERT_FALSE(out[written - 1] >= 0xD800 && out[written - 1] <= 0xDBFF) << capacity;
+        }
+        ASSERT_EQ(u'?', out[capacity]) << capacity;
+    }
+}
+
+TEST_P(TranscoderTest, Invalid)
+{
+    static const char* const bad[] = {
+        "\xC0\x80",             // overlong
+        "\xC1\xBF",
+        "\xE0\x80\x80",
+        "\xE0\x9F\xBF",
+        "\xF0\x80\x80\x80",
+        "\xF0\x8F\xBF\xBF",
+        "\xED\xA0\x80",         // surrogates
+        "\xED\xBF\xBF",
+        "\xF4\x90\x80\x80",     // past U+10FFFF
+        "\xF5\x80\x80\x80",
+        "\x80",                 // a continuation byte on its own
+        "\xBF",
+        "\xE2\x28\xA1",         // a sequence cut short
+        "\xF0\x9F\x98",
+        "\xFE",
+        "\xFF",
+    };
+
+    for (const char* sequence : bad) {
+        // anywhere, including after ASCII and past the room given
+        for (size_t before = 0; before <= 70; before += 3) {
+            std::string    text = std::string(before, 'x') + sequence + "yz";
+            std::u16string converted;
+            ASSERT_FALSE(Transcoder::utf8ToUtf16(text.data(), text.size(), converted)) << before;
+
+            char16_t out[8];
+            size_t   written;
+            size_t   required;
+            ASSERT_FALSE(Transcoder::utf8ToUtf16(text.data(), text.size(), out, 8, &written, &required)) << before;
+            ASSERT_FALSE(Transcoder::utf8ToUtf16(text.data(), text.size(), out, 0, &written, &required)) << before;
+        }
+    }
+
+    // cut off at the very end of the value
+    std::string    text = "abc\xE2\x82";
+    std::u16string converted;
+    EXPECT_FALSE(Transcoder::utf8ToUtf16(text.data(), text.size(), converted));
+}
+
+TEST_P(TranscoderTest, Pieces)
+{
+    std::vector<uint32_t> codePoints = makeCodePoints(400);
+    std::string           text = toUtf8(codePoints);
+    std::u16string        whole = toUtf16(codePoints);
+
+    // pieces that end part way through sequences, and room that ends part
+    // way through surrogate pairs
+    for (size_t chunk : { 1, 2, 3, 5, 16, 33, 100, 4096 }) {
+        for (size_t capacity = 1; capacity <= 40; ++capacity) {
+            std::u16string converted;
+            ASSERT_TRUE(readPieces(text, chunk, capacity, converted)) << chunk << " " << capacity;
+            ASSERT_EQ(whole, converted) << chunk << " " << capacity;
+        }
+    }
+}
+
+TEST_P(TranscoderTest, PiecePending)
+{
+    // U+1F600 is D83D DE00
+    std::string text = "ab\xF0\x9F\x98\x80" "c";
+    char16_t    out[3];
+    size_t      consumed;
+    size_t      written;
+    char16_t    pending;
+
+    ASSERT_TRUE(Transcoder::utf8ToUtf16Piece(text.data(), text.size(), out, 3, &consumed, &written, &pending));
+    EXPECT_EQ((size_t)6, consumed);
+    EXPECT_EQ((size_t)3, written);
+    EXPECT_EQ(u'a', out[0]);
+    EXPECT_EQ(u'b', out[1]);
+    EXPECT_EQ((char16_t)0xD83D, out[2]);
+    EXPECT_EQ((char16_t)0xDE00, pending);
+
+    // with room for both halves nothing is pending
+    char16_t more[4];
+    ASSERT_TRUE(Transcoder::utf8ToUtf16Piece(text.data(), text.size(), more, 4, &consumed, &written, &pending));
+    EXPECT_EQ((size_t)6, consumed);
+    EXPECT_EQ((size_t)4, written);
+    EXPECT_EQ((char16_t)0xDE00, more[3]);
+    EXPECT_EQ(0, pending);
+}
+
+TEST_P(TranscoderTest, PieceCutOff)
+{
+    std::string text = "abc\xE2\x82\xAC";
+    char16_t    out[8];
+    size_t      consumed;
+    size_t      written;
+    char16_t    pending;
+
+    // the euro sign's first bytes are left for the next piece...
+    for (size_t length = 3; length < text.size(); ++length) {
+        ASSERT_TRUE(Transcoder::utf8ToUtf16Piece(text.data(), length, out, 8, &consumed, &written, &pending)) << length;
+        EXPECT_EQ((size_t)3, consumed) << length;
+        EXPECT_EQ((size_t)3, written) << length;
+        EXPECT_EQ(0, pending);
+    }
+
+    // ...but not a sequence that's wrong before it's cut off
+    std::string wrong = "abc\xE2\x28";
+    EXPECT_FALSE(Transcoder::utf8ToUtf16Piece(wrong.data(), wrong.size(), out, 8, &consumed, &written, &pending));
+    std::string overlong = "abc\xC0";
+    EXPECT_FALSE(Transcoder::utf8ToUtf16Piece(overlong.data(), overlong.size(), out, 8, &consumed, &written, &pending));
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, TranscoderTest, ::testing::Values("scalar", "sse2", "avx2"));